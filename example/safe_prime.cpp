@@ -6,7 +6,7 @@
 //[safe_prime
 
 #include <boost/multiprecision/cpp_int.hpp>
-#include <boost/multiprecision/miller_rabin.hpp>
+#include <boost/multiprecision/prime_generation.hpp>
 #include <iostream>
 #include <iomanip>
 
@@ -16,29 +16,20 @@ int main()
    using namespace boost::multiprecision;
 
    typedef cpp_int int_type;
-   mt11213b base_gen(clock());
-   independent_bits_engine<mt11213b, 256, int_type> gen(base_gen);
    //
-   // We must use a different generator for the tests and number generation, otherwise
-   // we get false positives.
+   // The generator is used to pick where the search starts, random_safe_prime seeds its own
+   // generator for the Miller-Rabin tests from it:
    //
-   mt19937 gen2(clock());
-
-   for(unsigned i = 0; i < 100000; ++i)
-   {
-      int_type n = gen();
-      if(miller_rabin_test(n, 25, gen2))
-      {
-         // Value n is probably prime, see if (n-1)/2 is also prime:
-         std::cout << "We have a probable prime with value: " << std::hex << std::showbase << n << std::endl;
-         if(miller_rabin_test((n-1)/2, 25, gen2))
-         {
-            std::cout << "We have a safe prime with value: " << std::hex << std::showbase << n << std::endl;
-            return 0;
-         }
-      }
-   }
-   std::cout << "Ooops, no safe primes were found - probably a bad choice of seed values!" << std::endl;
+   mt11213b gen(clock());
+   //
+   // A 256-bit value p, for which p and (p-1)/2 are both probably prime:
+   //
+   int_type p = random_safe_prime<int_type>(256, 25, gen);
+   std::cout << "We have a safe prime with value: " << std::hex << std::showbase << p << std::endl;
+   //
+   // And the first probable prime after it:
+   //
+   std::cout << "The next prime is: " << std::hex << std::showbase << next_prime(p, 25) << std::endl;
    return 0;
 }
 
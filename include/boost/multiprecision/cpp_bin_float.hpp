@@ -559,11 +559,13 @@ inline void copy_and_round(cpp_bin_float<Digits, DigitBase, Allocator, Exponent,
       res.bits()     = static_cast<limb_type>(0u);
       return;
    }
+   BOOST_MP_INSTRUMENT_COUNT(counter_bin_float_normalize);
    int msb = eval_msb(arg);
    if (static_cast<int>(bits_to_keep) > msb + 1)
    {
       // Must have had cancellation in subtraction,
       // or be converting from a narrower type, so shift left:
+      BOOST_MP_INSTRUMENT_COUNT(counter_bin_float_shift);
       res.bits() = arg;
       eval_left_shift(res.bits(), bits_to_keep - msb - 1);
       res.exponent() -= static_cast<Exponent>(bits_to_keep - msb - 1);
@@ -572,6 +574,7 @@ inline void copy_and_round(cpp_bin_float<Digits, DigitBase, Allocator, Exponent,
    {
       // We have more bits_to_keep than we need, so round as required,
       // first get the rounding bit:
+      BOOST_MP_INSTRUMENT_COUNT(counter_bin_float_round);
       bool roundup = eval_bit_test(arg, msb - bits_to_keep);
       // Then check for a tie:
       if (roundup && (msb - bits_to_keep == (int)eval_lsb(arg)))
@@ -1838,6 +1841,7 @@ using boost::multiprecision::signbit;
 
 #include <boost/multiprecision/cpp_bin_float/io.hpp>
 #include <boost/multiprecision/cpp_bin_float/transcendental.hpp>
+#include <boost/multiprecision/cpp_bin_float/binary_io.hpp>
 
 namespace std {
 
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// The compact binary record for cpp_bin_float: a byte holding the sign and class of the value,
+// then for non-zero finite values the exponent and an integer record (see cpp_int/binary_io.hpp)
+// holding the significand with its trailing zero bits removed.  The value is the significand
+// scaled so that its most significant bit has the given exponent, which doesn't depend on the
+// precision of the type which wrote it.
+//
+
+#ifndef BOOST_MP_CPP_BIN_FLOAT_BINARY_IO_HPP
+#define BOOST_MP_CPP_BIN_FLOAT_BINARY_IO_HPP
+
+namespace boost { namespace multiprecision {
+
+namespace detail {
+
+template <unsigned Digits, backends::digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+struct binary_format<backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> >
+{
+   static const unsigned char    kind      = binary_format_binary_float;
+   static const boost::uintmax_t precision = backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count;
+};
+
+} // namespace detail
+
+namespace backends {
+
+template <class Writer, unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+void eval_write_binary(Writer& w, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& val)
+{
+   typedef cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> float_type;
+
+   unsigned char flags = val.sign() ? boost::multiprecision::detail::binary_sign_flag : 0;
+   switch (val.exponent())
+   {
+   case float_type::exponent_zero:
+      w.write_byte(flags | boost::multiprecision::detail::binary_class_zero);
+      break;
+   case float_type::exponent_infinity:
+      w.write_byte(flags | boost::multiprecision::detail::binary_class_infinity);
+      break;
+   case float_type::exponent_nan:
+      w.write_byte(flags | boost::multiprecision::detail::binary_class_nan);
+      break;
+   default:
+      w.write_byte(flags | boost::multiprecision::detail::binary_class_finite);
+      w.write_signed_varint(val.exponent());
+      typename float_type::rep_type m(val.bits());
+      eval_right_shift(m, eval_lsb(m));
+      eval_write_binary(w, m);
+   }
+}
+
+template <class Reader, unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+void eval_read_binary(Reader& r, cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& val)
+{
+   typedef cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> float_type;
+
+   unsigned char flags = r.read_byte();
+   if (flags & ~(boost::multiprecision::detail::binary_sign_flag | boost::multiprecision::detail::binary_class_mask))
+      r.invalid();
+   val.bits() = static_cast<limb_type>(0u);
+   switch (flags & boost::multiprecision::detail::binary_class_mask)
+   {
+   case boost::multiprecision::detail::binary_class_zero:
+      val.exponent() = float_type::exponent_zero;
+      break;
+   case boost::multiprecision::detail::binary_class_infinity:
+      val.exponent() = float_type::exponent_infinity;
+      break;
+   case boost::multiprecision::detail::binary_class_nan:
+      val.exponent() = float_type::exponent_nan;
+      break;
+   default:
+   {
+      boost::intmax_t   e = r.read_signed_varint();
+      cpp_int_backend<> m;
+      eval_read_binary(r, m);
+      if (m.sign() || eval_is_zero(m))
+         r.invalid();
+      int msb = eval_msb(m);
+      if (msb > static_cast<int>(float_type::bit_count) + 1)
+      {
+         //
+         // Written at a higher precision: keep a guard bit and fold everything below it into
+         // a sticky bit so that copy_and_round rounds exactly as it would have from m:
+         //
+         bool sticky = static_cast<int>(eval_lsb(m)) < msb - static_cast<int>(float_type::bit_count) - 1;
+         eval_right_shift(m, msb - float_type::bit_count - 1);
+         if (sticky)
+            m.limbs()[0] |= 1u;
+         msb = float_type::bit_count + 1;
+      }
+      if (e > float_type::max_exponent)
+         val.exponent() = float_type::exponent_infinity;
+      else if (e < float_type::min_exponent - 1)
+         val.exponent() = float_type::exponent_zero;
+      else
+      {
+         //
+         // copy_and_round takes the exponent of bit bit_count - 1 of m:
+         //
+         val.exponent() = static_cast<Exponent>(e - msb + static_cast<int>(float_type::bit_count) - 1);
+         copy_and_round(val, m);
+      }
+   }
+   }
+   val.sign() = (flags & boost::multiprecision::detail::binary_sign_flag) != 0;
+}
+
+} // namespace backends
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -615,6 +615,54 @@ class cpp_dec_float
       ar& boost::make_nvp("class-type", fpclass);
       ar& boost::make_nvp("precision", prec_elem);
    }
+   //
+   // The compact binary record: a byte holding the sign and class of the value, then for non-zero
+   // finite values the exponent, the number of elements up to the last non-zero one, and those
+   // elements, 4 bytes each:
+   //
+   template <class Writer>
+   void write_binary(Writer& w) const
+   {
+      unsigned char flags = neg ? boost::multiprecision::detail::binary_sign_flag : 0;
+      if (fpclass == cpp_dec_float_NaN)
+         flags |= boost::multiprecision::detail::binary_class_nan;
+      else if (fpclass == cpp_dec_float_inf)
+         flags |= boost::multiprecision::detail::binary_class_infinity;
+      else if (!iszero())
+         flags |= boost::multiprecision::detail::binary_class_finite;
+      w.write_byte(flags);
+      if ((flags & boost::multiprecision::detail::binary_class_mask) != boost::multiprecision::detail::binary_class_finite)
+         return;
+      boost::int32_t n = cpp_dec_float_elem_number;
+      while (!data[n - 1])
+         --n;
+      w.write_signed_varint(exp);
+      w.write_varint(n);
+      for (boost::int32_t i = 0; i < n; ++i)
+         w.write_bytes(data[i], 4);
+   }
+   template <class Reader>
+   void read_binary(Reader& r)
+   {
+      unsigned char flags = r.read_byte();
+      if (flags & ~(boost::multiprecision::detail::binary_sign_flag | boost::multiprecision::detail::binary_class_mask))
+         r.invalid();
+      switch (flags & boost::multiprecision::detail::binary_class_mask)
+      {
+      case boost::multiprecision::detail::binary_class_nan:
+         *this = nan();
+         break;
+      case boost::multiprecision::detail::binary_class_infinity:
+         *this = inf();
+         break;
+      case boost::multiprecision::detail::binary_class_zero:
+         *this = zero();
+         break;
+      default:
+         read_binary_digits(r);
+      }
+      neg = (flags & boost::multiprecision::detail::binary_sign_flag) != 0;
+   }
 
  private:
    static bool data_elem_is_non_zero_predicate(const boost::uint32_t& d) { return (d != static_cast<boost::uint32_t>(0u)); }
@@ -623,6 +671,52 @@ class cpp_dec_float
 
    void from_unsigned_long_long(const boost::ulong_long_type u);
 
+   template <class Reader>
+   void read_binary_digits(Reader& r)
+   {
+      boost::intmax_t  e = r.read_signed_varint();
+      boost::uintmax_t n = r.read_varint();
+      if ((e % cpp_dec_float_elem_digits10) || !n)
+         r.invalid();
+      if (n > static_cast<boost::uintmax_t>(cpp_dec_float_elem_number))
+      {
+         //
+         // Written at a higher precision, let the string conversion do the rounding:
+         //
+         std::string s;
+         for (boost::uintmax_t i = 0; i < n; ++i)
+         {
+            boost::uint32_t d = r.template read_bytes<boost::uint32_t>(4);
+            if ((d >= static_cast<boost::uint32_t>(cpp_dec_float_elem_mask)) || (!i && !d))
+               r.invalid();
+            std::string digits = boost::multiprecision::detail::itos(d);
+            if (i)
+               s.append(cpp_dec_float_elem_digits10 - digits.size(), '0');
+            s += digits;
+            if (!i)
+               s += '.';
+         }
+         s += "e" + boost::multiprecision::detail::itos(e);
+         *this = s.c_str();
+         return;
+      }
+      *this = zero();
+      for (boost::int32_t i = 0; i < static_cast<boost::int32_t>(n); ++i)
+      {
+         data[i] = r.template read_bytes<boost::uint32_t>(4);
+         if (data[i] >= static_cast<boost::uint32_t>(cpp_dec_float_elem_mask))
+            r.invalid();
+      }
+      if (!data[0])
+         r.invalid();
+      if (e > cpp_dec_float_max_exp10)
+         *this = inf();
+      else if (e < cpp_dec_float_min_exp10)
+         *this = zero();
+      else
+         exp = static_cast<ExponentType>(e);
+   }
+
    int cmp_data(const array_type& vd) const;
 
    static boost::uint32_t mul_loop_uv(boost::uint32_t* const u, const boost::uint32_t* const v, const boost::int32_t p);
@@ -3028,8 +3122,30 @@ inline std::size_t hash_value(const cpp_dec_float<Digits10, ExponentType, Alloca
    return val.hash();
 }
 
+template <class Writer, unsigned Digits10, class ExponentType, class Allocator>
+inline void eval_write_binary(Writer& w, const cpp_dec_float<Digits10, ExponentType, Allocator>& val)
+{
+   val.write_binary(w);
+}
+template <class Reader, unsigned Digits10, class ExponentType, class Allocator>
+inline void eval_read_binary(Reader& r, cpp_dec_float<Digits10, ExponentType, Allocator>& val)
+{
+   val.read_binary(r);
+}
+
 } // namespace backends
 
+namespace detail {
+
+template <unsigned Digits10, class ExponentType, class Allocator>
+struct binary_format<backends::cpp_dec_float<Digits10, ExponentType, Allocator> >
+{
+   static const unsigned char    kind      = binary_format_decimal_float;
+   static const boost::uintmax_t precision = Digits10;
+};
+
+} // namespace detail
+
 using boost::multiprecision::backends::cpp_dec_float;
 
 typedef number<cpp_dec_float<50> >  cpp_dec_float_50;
@@ -23,7 +23,11 @@
 #include <boost/integer/static_min_max.hpp>
 #include <boost/type_traits/common_type.hpp>
 #include <boost/type_traits/make_signed.hpp>
+#include <boost/type_traits/remove_cv.hpp>
 #include <boost/multiprecision/cpp_int/checked.hpp>
+#include <boost/multiprecision/cpp_int/pooled_allocator.hpp>
+#include <boost/multiprecision/cpp_int/arena.hpp>
+#include <boost/multiprecision/detail/instrumentation.hpp>
 #include <boost/multiprecision/detail/constexpr.hpp>
 #ifdef BOOST_MP_USER_DEFINED_LITERALS
 #include <boost/multiprecision/cpp_int/value_pack.hpp>
@@ -150,6 +154,19 @@ struct is_fixed_precision<cpp_int_backend<MinBits, MaxBits, SignType, Checked, A
     : public mpl::bool_<max_precision<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::value != UINT_MAX>
 {};
 
+//
+// The variable precision signed type used for intermediate results, which shares the allocator
+// of the argument type if it has one, and with it the size of the internal limb cache:
+//
+template <class CppInt>
+struct unbounded_working_type;
+
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+struct unbounded_working_type<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >
+{
+   typedef cpp_int_backend<is_void<Allocator>::value ? 0 : MinBits, 0, signed_magnitude, unchecked, typename mpl::if_<is_void<Allocator>, std::allocator<limb_type>, Allocator>::type> type;
+};
+
 namespace detail {
 
 inline BOOST_MP_CXX14_CONSTEXPR void verify_new_size(unsigned new_size, unsigned min_size, const mpl::int_<checked>&)
@@ -207,10 +224,14 @@ struct cpp_int_base<MinBits, MaxBits, signed_magnitude, Checked, Allocator, fals
    BOOST_STATIC_CONSTANT(unsigned, limb_bits = sizeof(limb_type) * CHAR_BIT);
    BOOST_STATIC_CONSTANT(limb_type, max_limb_value = ~static_cast<limb_type>(0u));
    BOOST_STATIC_CONSTANT(limb_type, sign_bit_mask = static_cast<limb_type>(1u) << (limb_bits - 1));
+   //
+   // The internal cache holds MinBits, but never less than the space taken by limb_data anyway:
+   //
+   BOOST_STATIC_CONSTANT(unsigned, default_limb_count = (sizeof(limb_data) / sizeof(limb_type)) > 1 ? (sizeof(limb_data) / sizeof(limb_type)) : 2);
    BOOST_STATIC_CONSTANT(unsigned, internal_limb_count =
-                                       MinBits
+                                       (MinBits / limb_bits + ((MinBits % limb_bits) ? 1 : 0)) > default_limb_count
                                            ? (MinBits / limb_bits + ((MinBits % limb_bits) ? 1 : 0))
-                                           : (sizeof(limb_data) / sizeof(limb_type)) > 1 ? (sizeof(limb_data) / sizeof(limb_type)) : 2);
+                                           : default_limb_count);
  private:
    union data_type
    {
@@ -291,12 +312,17 @@ struct cpp_int_base<MinBits, MaxBits, signed_magnitude, Checked, Allocator, fals
           : boost::empty_value<allocator_type>(boost::empty_init_t(), a), capacity(len), allocated(0), is_alias(false)
       {
          data = allocator().allocate(len);
+         BOOST_MP_INSTRUMENT_COUNT(counter_cpp_int_allocate);
+         BOOST_MP_INSTRUMENT_ADD(counter_cpp_int_limbs, len);
       }
       scoped_shared_storage(limb_type* limbs, unsigned n) : data(limbs), capacity(n), allocated(0), is_alias(true) {}
       ~scoped_shared_storage()
       {
          if(!is_alias)
+         {
             allocator().deallocate(data, capacity);
+            BOOST_MP_INSTRUMENT_COUNT(counter_cpp_int_deallocate);
+         }
       }
       limb_type* allocate(unsigned n) BOOST_NOEXCEPT 
       {
@@ -368,9 +394,15 @@ struct cpp_int_base<MinBits, MaxBits, signed_magnitude, Checked, Allocator, fals
          // Allocate a new buffer and copy everything over:
          cap             = (std::min)((std::max)(cap * 4, new_size), max_limbs);
          limb_pointer pl = allocator().allocate(cap);
+         BOOST_MP_INSTRUMENT_COUNT(counter_cpp_int_resize);
+         BOOST_MP_INSTRUMENT_COUNT(counter_cpp_int_allocate);
+         BOOST_MP_INSTRUMENT_ADD(counter_cpp_int_limbs, cap);
          std::memcpy(pl, limbs(), size() * sizeof(limbs()[0]));
          if (!m_internal && !m_alias)
+         {
             allocator().deallocate(limbs(), capacity());
+            BOOST_MP_INSTRUMENT_COUNT(counter_cpp_int_deallocate);
+         }
          else
             m_internal = false;
          m_limbs            = new_size;
@@ -389,17 +421,14 @@ struct cpp_int_base<MinBits, MaxBits, signed_magnitude, Checked, Allocator, fals
          --m_limbs;
    }
    BOOST_MP_FORCEINLINE BOOST_CONSTEXPR cpp_int_base() BOOST_NOEXCEPT : m_data(), m_limbs(1), m_sign(false), m_internal(true), m_alias(false){}
-   BOOST_MP_FORCEINLINE                 cpp_int_base(const cpp_int_base& o) : base_type(o), m_limbs(o.m_alias ? o.m_limbs : 0), m_sign(o.m_sign), m_internal(o.m_alias ? false : true), m_alias(o.m_alias)
+   //
+   // Copies of aliases own their limbs: an alias may refer to storage which doesn't outlive it,
+   // or which someone else is free to modify, so only moves carry the alias over:
+   //
+   BOOST_MP_FORCEINLINE                 cpp_int_base(const cpp_int_base& o) : base_type(o), m_limbs(0), m_sign(o.m_sign), m_internal(true), m_alias(false)
    {
-      if (m_alias)
-      {
-         m_data.ld = o.m_data.ld;
-      }
-      else
-      {
-         resize(o.size(), o.size());
-         std::memcpy(limbs(), o.limbs(), o.size() * sizeof(limbs()[0]));
-      }
+      resize(o.size(), o.size());
+      std::memcpy(limbs(), o.limbs(), o.size() * sizeof(limbs()[0]));
    }
 #ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
    cpp_int_base(cpp_int_base&& o)
@@ -419,7 +448,10 @@ struct cpp_int_base<MinBits, MaxBits, signed_magnitude, Checked, Allocator, fals
    cpp_int_base& operator=(cpp_int_base&& o) BOOST_NOEXCEPT
    {
       if (!m_internal && !m_alias)
+      {
          allocator().deallocate(m_data.ld.data, m_data.ld.capacity);
+         BOOST_MP_INSTRUMENT_COUNT(counter_cpp_int_deallocate);
+      }
       *static_cast<base_type*>(this) = static_cast<base_type&&>(o);
       m_limbs                        = o.m_limbs;
       m_sign                         = o.m_sign;
@@ -441,7 +473,10 @@ struct cpp_int_base<MinBits, MaxBits, signed_magnitude, Checked, Allocator, fals
    BOOST_MP_FORCEINLINE ~cpp_int_base() BOOST_NOEXCEPT
    {
       if (!m_internal && !m_alias)
+      {
          allocator().deallocate(limbs(), capacity());
+         BOOST_MP_INSTRUMENT_COUNT(counter_cpp_int_deallocate);
+      }
    }
    void assign(const cpp_int_base& o)
    {
@@ -473,6 +508,7 @@ struct cpp_int_base<MinBits, MaxBits, signed_magnitude, Checked, Allocator, fals
       std::swap(m_data, o.m_data);
       std::swap(m_sign, o.m_sign);
       std::swap(m_internal, o.m_internal);
+      std::swap(m_alias, o.m_alias);
       std::swap(m_limbs, o.m_limbs);
    }
 
@@ -490,6 +526,8 @@ const limb_type cpp_int_base<MinBits, MaxBits, signed_magnitude, Checked, Alloca
 template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
 const limb_type cpp_int_base<MinBits, MaxBits, signed_magnitude, Checked, Allocator, false>::sign_bit_mask;
 template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+const unsigned cpp_int_base<MinBits, MaxBits, signed_magnitude, Checked, Allocator, false>::default_limb_count;
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
 const unsigned cpp_int_base<MinBits, MaxBits, signed_magnitude, Checked, Allocator, false>::internal_limb_count;
 
 #endif
@@ -1644,8 +1682,6 @@ struct cpp_int_backend
    }
    void do_assign_string(const char* s, const mpl::false_&)
    {
-      using default_ops::eval_add;
-      using default_ops::eval_multiply;
       std::size_t n  = s ? std::strlen(s) : 0;
       *this          = static_cast<limb_type>(0u);
       unsigned radix = 10;
@@ -1678,118 +1714,13 @@ struct cpp_int_backend
       cpp_int_backend result;
       if (n)
       {
-         if (radix == 16)
+         if ((radix == 16) || (radix == 8))
          {
-            while (*s == '0')
-               ++s;
-            std::size_t bitcount = 4 * std::strlen(s);
-            limb_type   val;
-            std::size_t limb, shift;
-            if (bitcount > 4)
-               bitcount -= 4;
-            else
-               bitcount = 0;
-            std::size_t newsize = bitcount / (sizeof(limb_type) * CHAR_BIT) + 1;
-            result.resize(static_cast<unsigned>(newsize), static_cast<unsigned>(newsize)); // will throw if this is a checked integer that cannot be resized
-            std::memset(result.limbs(), 0, result.size() * sizeof(limb_type));
-            while (*s)
-            {
-               if (*s >= '0' && *s <= '9')
-                  val = *s - '0';
-               else if (*s >= 'a' && *s <= 'f')
-                  val = 10 + *s - 'a';
-               else if (*s >= 'A' && *s <= 'F')
-                  val = 10 + *s - 'A';
-               else
-               {
-                  BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected content found while parsing character string."));
-               }
-               limb  = bitcount / (sizeof(limb_type) * CHAR_BIT);
-               shift = bitcount % (sizeof(limb_type) * CHAR_BIT);
-               val <<= shift;
-               if (result.size() > limb)
-               {
-                  result.limbs()[limb] |= val;
-               }
-               ++s;
-               bitcount -= 4;
-            }
-            result.normalize();
-         }
-         else if (radix == 8)
-         {
-            while (*s == '0')
-               ++s;
-            std::size_t bitcount = 3 * std::strlen(s);
-            limb_type   val;
-            std::size_t limb, shift;
-            if (bitcount > 3)
-               bitcount -= 3;
-            else
-               bitcount = 0;
-            std::size_t newsize = bitcount / (sizeof(limb_type) * CHAR_BIT) + 1;
-            result.resize(static_cast<unsigned>(newsize), static_cast<unsigned>(newsize)); // will throw if this is a checked integer that cannot be resized
-            std::memset(result.limbs(), 0, result.size() * sizeof(limb_type));
-            while (*s)
-            {
-               if (*s >= '0' && *s <= '7')
-                  val = *s - '0';
-               else
-               {
-                  BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected content found while parsing character string."));
-               }
-               limb  = bitcount / (sizeof(limb_type) * CHAR_BIT);
-               shift = bitcount % (sizeof(limb_type) * CHAR_BIT);
-               if (result.size() > limb)
-               {
-                  result.limbs()[limb] |= (val << shift);
-                  if (shift > sizeof(limb_type) * CHAR_BIT - 3)
-                  {
-                     // Deal with the bits in val that overflow into the next limb:
-                     val >>= (sizeof(limb_type) * CHAR_BIT - shift);
-                     if (val)
-                     {
-                        // If this is the most-significant-limb, we may need to allocate an extra one for the overflow:
-                        if (limb + 1 == newsize)
-                           result.resize(static_cast<unsigned>(newsize + 1), static_cast<unsigned>(newsize + 1));
-                        if (result.size() > limb + 1)
-                        {
-                           result.limbs()[limb + 1] |= val;
-                        }
-                     }
-                  }
-               }
-               ++s;
-               bitcount -= 3;
-            }
-            result.normalize();
+            power_of_two_from_chars(result, s, s + std::strlen(s), radix == 16 ? 4 : 3);
          }
          else
          {
-            // Base 10, we extract blocks of size 10^9 at a time, that way
-            // the number of multiplications is kept to a minimum:
-            limb_type block_mult = max_block_10;
-            while (*s)
-            {
-               limb_type block = 0;
-               for (unsigned i = 0; i < digits_per_block_10; ++i)
-               {
-                  limb_type val;
-                  if (*s >= '0' && *s <= '9')
-                     val = *s - '0';
-                  else
-                     BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected character encountered in input."));
-                  block *= 10;
-                  block += val;
-                  if (!*++s)
-                  {
-                     block_mult = block_multiplier(i);
-                     break;
-                  }
-               }
-               eval_multiply(result, block_mult);
-               eval_add(result, block);
-            }
+            decimal_from_chars(result, s, s + n);
          }
       }
       if (isneg)
@@ -1913,100 +1844,9 @@ struct cpp_int_backend
    }
    std::string do_get_string(std::ios_base::fmtflags f, const mpl::false_&) const
    {
-      using default_ops::eval_get_sign;
-      int base = 10;
-      if ((f & std::ios_base::oct) == std::ios_base::oct)
-         base = 8;
-      else if ((f & std::ios_base::hex) == std::ios_base::hex)
-         base = 16;
-      std::string result;
-
-      unsigned Bits = this->size() * base_type::limb_bits;
-
-      if (base == 8 || base == 16)
-      {
-         if (this->sign())
-            BOOST_THROW_EXCEPTION(std::runtime_error("Base 8 or 16 printing of negative numbers is not supported."));
-         limb_type       shift = base == 8 ? 3 : 4;
-         limb_type       mask  = static_cast<limb_type>((1u << shift) - 1);
-         cpp_int_backend t(*this);
-         result.assign(Bits / shift + ((Bits % shift) ? 1 : 0), '0');
-         std::string::difference_type pos      = result.size() - 1;
-         char                         letter_a = f & std::ios_base::uppercase ? 'A' : 'a';
-         for (unsigned i = 0; i < Bits / shift; ++i)
-         {
-            char c = '0' + static_cast<char>(t.limbs()[0] & mask);
-            if (c > '9')
-               c += letter_a - '9' - 1;
-            result[pos--] = c;
-            eval_right_shift(t, shift);
-         }
-         if (Bits % shift)
-         {
-            mask   = static_cast<limb_type>((1u << (Bits % shift)) - 1);
-            char c = '0' + static_cast<char>(t.limbs()[0] & mask);
-            if (c > '9')
-               c += letter_a - '9';
-            result[pos] = c;
-         }
-         //
-         // Get rid of leading zeros:
-         //
-         std::string::size_type n = result.find_first_not_of('0');
-         if (!result.empty() && (n == std::string::npos))
-            n = result.size() - 1;
-         result.erase(0, n);
-         if (f & std::ios_base::showbase)
-         {
-            const char* pp = base == 8 ? "0" : (f & std::ios_base::uppercase) ? "0X" : "0x";
-            result.insert(static_cast<std::string::size_type>(0), pp);
-         }
-      }
-      else
-      {
-         result.assign(Bits / 3 + 1, '0');
-         std::string::difference_type pos = result.size() - 1;
-         cpp_int_backend              t(*this);
-         cpp_int_backend              r;
-         bool                         neg = false;
-         if (t.sign())
-         {
-            t.negate();
-            neg = true;
-         }
-         if (this->size() == 1)
-         {
-            result = boost::lexical_cast<std::string>(t.limbs()[0]);
-         }
-         else
-         {
-            cpp_int_backend block10;
-            block10 = max_block_10;
-            while (eval_get_sign(t) != 0)
-            {
-               cpp_int_backend t2;
-               divide_unsigned_helper(&t2, t, block10, r);
-               t           = t2;
-               limb_type v = r.limbs()[0];
-               for (unsigned i = 0; i < digits_per_block_10; ++i)
-               {
-                  char c = '0' + v % 10;
-                  v /= 10;
-                  result[pos] = c;
-                  if (pos-- == 0)
-                     break;
-               }
-            }
-         }
-         std::string::size_type n = result.find_first_not_of('0');
-         result.erase(0, n);
-         if (result.empty())
-            result = "0";
-         if (neg)
-            result.insert(static_cast<std::string::size_type>(0), 1, '-');
-         else if (f & std::ios_base::showpos)
-            result.insert(static_cast<std::string::size_type>(0), 1, '+');
-      }
+      std::string result(cpp_int_to_chars_size(*this, f), '0');
+      char*       end = cpp_int_to_chars(&result[0], &result[0] + result.size(), *this, f);
+      result.erase(end - &result[0]);
       return result;
    }
 
@@ -2085,7 +1925,7 @@ struct cpp_int_backend
          return this->sign() ? -1 : 1;
 
       // Only do the compare if the same sign:
-      int result = compare_unsigned(o);
+      int result = compare_unsigned_fixed_width(*this, o);
 
       if (this->sign())
          result = -result;
@@ -2195,6 +2035,17 @@ typedef number<cpp_int_backend<> >           cpp_int;
 typedef rational_adaptor<cpp_int_backend<> > cpp_rational_backend;
 typedef number<cpp_rational_backend>         cpp_rational;
 
+// Arbitrary precision integer whose limbs come from per-thread pools:
+typedef number<cpp_int_backend<0, 0, signed_magnitude, unchecked, pooled_allocator<limb_type> > > cpp_int_pooled;
+// Arbitrary precision integer whose limbs come from the innermost mp_arena, if any:
+typedef number<cpp_int_backend<0, 0, signed_magnitude, unchecked, arena_allocator<limb_type> > > cpp_int_arena;
+
+#ifndef BOOST_NO_CXX11_TEMPLATE_ALIASES
+// Arbitrary precision integer which holds values of up to InlineBits bits without allocating:
+template <unsigned InlineBits, class Allocator = std::allocator<limb_type> >
+using cpp_int_inline = number<cpp_int_backend<InlineBits, 0, signed_magnitude, unchecked, Allocator> >;
+#endif
+
 // Fixed precision unsigned types:
 typedef number<cpp_int_backend<128, 128, unsigned_magnitude, unchecked, void> >   uint128_t;
 typedef number<cpp_int_backend<256, 256, unsigned_magnitude, unchecked, void> >   uint256_t;
@@ -2245,15 +2096,21 @@ struct is_explicitly_convertible<cpp_int_backend<MinBits, MaxBits, SignType, Che
 //
 #include <boost/multiprecision/cpp_int/comparison.hpp>
 #include <boost/multiprecision/cpp_int/add.hpp>
+#include <boost/multiprecision/cpp_int/tuning.hpp>
+#include <boost/multiprecision/cpp_int/ntt.hpp>
 #include <boost/multiprecision/cpp_int/multiply.hpp>
 #include <boost/multiprecision/cpp_int/divide.hpp>
 #include <boost/multiprecision/cpp_int/bitwise.hpp>
+#include <boost/multiprecision/cpp_int/gcd.hpp>
 #include <boost/multiprecision/cpp_int/misc.hpp>
+#include <boost/multiprecision/cpp_int/montgomery.hpp>
+#include <boost/multiprecision/cpp_int/radix.hpp>
 #include <boost/multiprecision/cpp_int/limits.hpp>
 #ifdef BOOST_MP_USER_DEFINED_LITERALS
 #include <boost/multiprecision/cpp_int/literals.hpp>
 #endif
 #include <boost/multiprecision/cpp_int/serialize.hpp>
 #include <boost/multiprecision/cpp_int/import_export.hpp>
+#include <boost/multiprecision/cpp_int/binary_io.hpp>
 
 #endif
@@ -9,6 +9,7 @@
 #define BOOST_MP_CPP_INT_ADD_HPP
 
 #include <boost/multiprecision/detail/constexpr.hpp>
+#include <boost/multiprecision/cpp_int/fixed_width.hpp>
 
 namespace boost { namespace multiprecision { namespace backends {
 
@@ -25,6 +26,9 @@ inline BOOST_MP_CXX14_CONSTEXPR void add_unsigned(CppInt1& result, const CppInt2
 {
    using ::boost::multiprecision::std_constexpr::swap;
 
+   if (add_unsigned_fixed_width(result, a, b))
+      return;
+
    // Nothing fancy, just let uintmax_t take the strain:
    double_limb_type carry = 0;
    unsigned         m(0), x(0);
@@ -138,6 +142,9 @@ inline BOOST_MP_CXX14_CONSTEXPR void subtract_unsigned(CppInt1& result, const Cp
 {
    using ::boost::multiprecision::std_constexpr::swap;
 
+   if (subtract_unsigned_fixed_width(result, a, b))
+      return;
+
    // Nothing fancy, just let uintmax_t take the strain:
    double_limb_type borrow = 0;
    unsigned         m(0), x(0);
@@ -0,0 +1,256 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Scoped arenas for cpp_int temporaries.  While an mp_arena exists, arena_allocator takes the
+// blocks it hands out on that thread from large chunks owned by the arena, bumping a pointer
+// rather than calling operator new, and keeps freed blocks on the arena's own free lists (one for
+// each power of two size) for reuse.  Destroying the arena releases all of its chunks at once.
+//
+// Values which outlive the arena may still hold blocks from it: the chunks are then kept until the
+// last such block is freed, so nothing dangles, which is why each block carries a small header
+// naming its arena.  Blocks freed on a thread other than the arena's own are simply counted off.
+// Outside any arena, or without thread_local support, blocks come from the per-thread pools of
+// pooled_allocator.
+//
+
+#ifndef BOOST_MP_CPP_INT_ARENA_HPP
+#define BOOST_MP_CPP_INT_ARENA_HPP
+
+#include <boost/multiprecision/cpp_int/pooled_allocator.hpp>
+#include <boost/multiprecision/detail/atomic.hpp>
+
+namespace boost { namespace multiprecision {
+
+namespace detail {
+
+#ifdef BOOST_MP_USING_THREAD_LOCAL
+
+#ifdef BOOST_MT_NO_ATOMIC_INT
+typedef unsigned arena_count_type;
+typedef bool     arena_flag_type;
+#else
+typedef atomic_unsigned_type                 arena_count_type;
+typedef BOOST_MATH_ATOMIC_NS::atomic<bool> arena_flag_type;
+#endif
+
+static const unsigned arena_min_bin = 5;
+
+struct arena_chunk
+{
+   arena_chunk* next;
+   std::size_t  size;
+};
+
+struct arena_region
+{
+   arena_chunk*     chunks;
+   char*            top;
+   char*            end;
+   std::size_t      next_chunk_size;
+   void*            free_list[sizeof(std::size_t) * CHAR_BIT];
+   arena_region*    previous;
+   const void*      owner;
+   arena_flag_type  closed;
+   arena_count_type references; // Live blocks, plus one until the mp_arena is destroyed.
+};
+//
+// Each block starts with one of these, the size of which keeps what follows suitably aligned:
+//
+struct arena_block_header
+{
+   arena_region* region;
+   std::size_t   bin;
+};
+
+inline arena_region*& current_arena()
+{
+   static thread_local arena_region* current = 0;
+   return current;
+}
+
+inline void release_arena(arena_region* r)
+{
+   if (--r->references == 0)
+   {
+      while (arena_chunk* c = r->chunks)
+      {
+         r->chunks = c->next;
+         ::operator delete(c);
+      }
+      delete r;
+   }
+}
+
+inline void* arena_allocate(std::size_t bytes)
+{
+   std::size_t   total = bytes + sizeof(arena_block_header);
+   arena_region* r     = current_arena();
+   if (!r)
+   {
+      arena_block_header* h = static_cast<arena_block_header*>(limb_pool_allocate(total));
+      h->region             = 0;
+      h->bin                = 0;
+      return h + 1;
+   }
+   std::size_t bin = total <= (static_cast<std::size_t>(1u) << arena_min_bin) ? arena_min_bin : find_msb(total - 1) + 1;
+   void*       p   = r->free_list[bin];
+   if (p)
+      r->free_list[bin] = *static_cast<void**>(p);
+   else
+   {
+      std::size_t size = static_cast<std::size_t>(1u) << bin;
+      if (static_cast<std::size_t>(r->end - r->top) < size)
+      {
+         // Start a new chunk, the space left in the old one is abandoned:
+         std::size_t chunk_size = (std::max)(r->next_chunk_size, size);
+         arena_chunk* c          = static_cast<arena_chunk*>(::operator new(sizeof(arena_chunk) + chunk_size));
+         c->next                 = r->chunks;
+         c->size                 = chunk_size;
+         r->chunks               = c;
+         r->top                  = reinterpret_cast<char*>(c + 1);
+         r->end                  = r->top + chunk_size;
+         r->next_chunk_size      = chunk_size * 2;
+      }
+      p = r->top;
+      r->top += size;
+   }
+   ++r->references;
+   arena_block_header* h = static_cast<arena_block_header*>(p);
+   h->region             = r;
+   h->bin                = bin;
+   return h + 1;
+}
+
+inline void arena_deallocate(void* p, std::size_t bytes)
+{
+   arena_block_header* h = static_cast<arena_block_header*>(p) - 1;
+   arena_region*       r = h->region;
+   if (!r)
+   {
+      limb_pool_deallocate(h, bytes + sizeof(arena_block_header));
+      return;
+   }
+   //
+   // Only the owning thread may use the free lists, so test that first: the owner sets closed when
+   // its mp_arena is destroyed, which may be while another thread frees a block.  closed is atomic
+   // as well, since a later thread may be given the same current_arena() as a finished one:
+   //
+   if ((r->owner == &current_arena()) && !r->closed)
+   {
+      *static_cast<void**>(static_cast<void*>(h)) = r->free_list[h->bin];
+      r->free_list[h->bin]                        = h;
+   }
+   release_arena(r);
+}
+
+#else
+
+inline void* arena_allocate(std::size_t bytes)
+{
+   return limb_pool_allocate(bytes);
+}
+
+inline void arena_deallocate(void* p, std::size_t bytes)
+{
+   limb_pool_deallocate(p, bytes);
+}
+
+#endif
+
+} // namespace detail
+
+//
+// While an mp_arena exists, the blocks arena_allocator allocates on the same thread come from it.
+// Arenas nest, and must be destroyed in the reverse order of construction, as they will be when
+// they're local variables:
+//
+class mp_arena
+{
+ public:
+   explicit mp_arena(std::size_t initial_size = 64 * 1024)
+   {
+#ifdef BOOST_MP_USING_THREAD_LOCAL
+      m_region                  = new detail::arena_region();
+      m_region->next_chunk_size = initial_size;
+      m_region->previous        = detail::current_arena();
+      m_region->owner           = &detail::current_arena();
+      m_region->references      = 1;
+      detail::current_arena()   = m_region;
+#else
+      (void)initial_size;
+#endif
+   }
+   ~mp_arena()
+   {
+#ifdef BOOST_MP_USING_THREAD_LOCAL
+      BOOST_ASSERT(detail::current_arena() == m_region);
+      detail::current_arena() = m_region->previous;
+      m_region->closed        = true;
+      detail::release_arena(m_region);
+#endif
+   }
+
+ private:
+   mp_arena(const mp_arena&);
+   mp_arena& operator=(const mp_arena&);
+#ifdef BOOST_MP_USING_THREAD_LOCAL
+   detail::arena_region* m_region;
+#endif
+};
+
+template <class T>
+class arena_allocator
+{
+ public:
+   typedef T              value_type;
+   typedef T*             pointer;
+   typedef const T*       const_pointer;
+   typedef T&             reference;
+   typedef const T&       const_reference;
+   typedef std::size_t    size_type;
+   typedef std::ptrdiff_t difference_type;
+
+   template <class U>
+   struct rebind
+   {
+      typedef arena_allocator<U> other;
+   };
+
+   arena_allocator() BOOST_NOEXCEPT {}
+   template <class U>
+   arena_allocator(const arena_allocator<U>&) BOOST_NOEXCEPT {}
+
+   T* allocate(size_type n, const void* = 0)
+   {
+      if (n > max_size())
+         BOOST_THROW_EXCEPTION(std::bad_alloc());
+      return static_cast<T*>(detail::arena_allocate(n * sizeof(T)));
+   }
+   void deallocate(T* p, size_type n) BOOST_NOEXCEPT
+   {
+      detail::arena_deallocate(p, n * sizeof(T));
+   }
+   size_type max_size() const BOOST_NOEXCEPT
+   {
+      return (~static_cast<size_type>(0u) / 2 - 64) / sizeof(T);
+   }
+   void construct(T* p, const T& val) { ::new (static_cast<void*>(p)) T(val); }
+   void destroy(T* p) { p->~T(); }
+};
+
+template <class T, class U>
+inline bool operator==(const arena_allocator<T>&, const arena_allocator<U>&) BOOST_NOEXCEPT
+{
+   return true;
+}
+template <class T, class U>
+inline bool operator!=(const arena_allocator<T>&, const arena_allocator<U>&) BOOST_NOEXCEPT
+{
+   return false;
+}
+
+}} // namespace boost::multiprecision
+
+#endif
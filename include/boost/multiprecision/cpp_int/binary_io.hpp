@@ -0,0 +1,98 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// The compact binary record for cpp_int: varint(byte count * 2 + sign) followed by the bytes of the
+// magnitude, least significant first.  It doesn't depend on the limb size, so all cpp_int types
+// can read each other's data.
+//
+
+#ifndef BOOST_MP_CPP_INT_BINARY_IO_HPP
+#define BOOST_MP_CPP_INT_BINARY_IO_HPP
+
+namespace boost { namespace multiprecision {
+
+namespace detail {
+
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+struct binary_format<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >
+{
+   static const unsigned char    kind      = binary_format_integer;
+   static const boost::uintmax_t precision = 0;
+};
+
+} // namespace detail
+
+namespace backends {
+
+template <class Writer, unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+void eval_write_binary(Writer& w, const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val)
+{
+   static const unsigned limb_bytes = sizeof(val.limbs()[0]);
+
+   unsigned bytes = (val.size() == 1) && !val.limbs()[0] ? 0 : eval_msb_imp(val) / CHAR_BIT + 1;
+   w.write_varint((static_cast<boost::uintmax_t>(bytes) << 1) | (val.sign() ? 1u : 0u));
+   for (unsigned i = 0; bytes; ++i)
+   {
+      unsigned n = (std::min)(bytes, limb_bytes);
+      w.write_bytes(val.limbs()[i], n);
+      bytes -= n;
+   }
+}
+//
+// Reads the magnitude of a record whose header has already been read into the unbounded val.  The
+// byte count in the header isn't trusted: it mustn't be more than val can hold, and val grows as
+// the limbs are read, so a truncated record can't make us allocate more than the data present:
+//
+template <class Reader, class CppInt>
+void read_binary_magnitude(Reader& r, CppInt& val, boost::uintmax_t bytes)
+{
+   static const unsigned         limb_bits = CHAR_BIT * sizeof(limb_type);
+   static const boost::uintmax_t max_limbs = max_precision<CppInt>::value / limb_bits + (max_precision<CppInt>::value % limb_bits ? 1 : 0);
+
+   boost::uintmax_t limbs = bytes / sizeof(limb_type) + (bytes % sizeof(limb_type) ? 1 : 0);
+   if (limbs > max_limbs)
+      r.invalid();
+   val.resize(1u, 1u);
+   val.limbs()[0] = 0;
+   for (unsigned i = 0; bytes; ++i)
+   {
+      unsigned  n    = static_cast<unsigned>((std::min)(bytes, static_cast<boost::uintmax_t>(sizeof(limb_type))));
+      limb_type limb = r.template read_bytes<limb_type>(n);
+      val.resize(i + 1, i + 1);
+      val.limbs()[i] = limb;
+      bytes -= n;
+   }
+   val.normalize();
+}
+
+template <class Reader, unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+void eval_read_binary(Reader& r, cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val)
+{
+   typedef cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> backend_type;
+
+   boost::uintmax_t header = r.read_varint();
+   if (!is_trivial_cpp_int<backend_type>::value && (max_precision<backend_type>::value == UINT_MAX))
+   {
+      read_binary_magnitude(r, val, header >> 1);
+      val.sign(header & 1u);
+   }
+   else
+   {
+      //
+      // Fixed precision types may not have room for the value, so go via an unbounded integer and
+      // let assignment apply the usual overflow rules:
+      //
+      typename unbounded_working_type<backend_type>::type t;
+      read_binary_magnitude(r, t, header >> 1);
+      t.sign(header & 1u);
+      val = t;
+   }
+}
+
+} // namespace backends
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -10,6 +10,11 @@
 
 namespace boost { namespace multiprecision { namespace backends {
 
+template <class CppInt1, class CppInt2, class CppInt3>
+typename enable_if_c<!is_fixed_precision<CppInt1>::value>::type divide_burnikel_ziegler(CppInt1* result, const CppInt2& x, const CppInt3& y, CppInt1& r);
+template <class CppInt1, class CppInt2, class CppInt3>
+typename enable_if_c<is_fixed_precision<CppInt1>::value>::type divide_burnikel_ziegler(CppInt1*, const CppInt2&, const CppInt3&, CppInt1&) {}
+
 template <class CppInt1, class CppInt2, class CppInt3>
 BOOST_MP_CXX14_CONSTEXPR void divide_unsigned_helper(
     CppInt1*       result,
@@ -73,6 +78,18 @@ BOOST_MP_CXX14_CONSTEXPR void divide_unsigned_helper(
       divide_unsigned_helper(result, x, y.limbs()[y_order], r);
       return;
    }
+   //
+   // When both the divisor and the quotient are large, the recursive algorithm
+   // wins, as it gets to use Karatsuba multiplication.  Fixed precision types are
+   // never large enough to benefit, and mustn't allocate memory here:
+   //
+   if (!is_fixed_precision<CppInt1>::value && (y.size() >= get_cpp_int_tuning().burnikel_ziegler_cutoff)
+      && (x.size() >= y.size() + get_cpp_int_tuning().burnikel_ziegler_cutoff))
+   {
+      BOOST_MP_INSTRUMENT_COUNT(counter_divide_burnikel_ziegler);
+      divide_burnikel_ziegler(result, x, y, r);
+      return;
+   }
 
    typename CppInt2::const_limb_pointer px = x.limbs();
    typename CppInt3::const_limb_pointer py = y.limbs();
@@ -104,6 +121,7 @@ BOOST_MP_CXX14_CONSTEXPR void divide_unsigned_helper(
       }
    }
 
+   BOOST_MP_INSTRUMENT_COUNT_RUNTIME(counter_divide_schoolbook, r_order);
    CppInt1 t;
    bool    r_neg = false;
 
@@ -342,6 +360,7 @@ BOOST_MP_CXX14_CONSTEXPR void divide_unsigned_helper(
    // Find the most significant word of numerator.
    //
    limb_type r_order = x.size() - 1;
+   BOOST_MP_INSTRUMENT_COUNT_RUNTIME(counter_divide_limb, r_order);
 
    //
    // Set remainder and result to their initial values:
@@ -449,6 +468,195 @@ BOOST_MP_CXX14_CONSTEXPR void divide_unsigned_helper(
    BOOST_ASSERT(r.compare(y) < 0); // remainder must be less than the divisor or our code has failed
 }
 
+//
+// Recursive division, from Burnikel and Ziegler, "Fast Recursive Division", MPI-I-98-1-022 (1998).
+// All the routines below work on variable precision values, and require the divisor b to be
+// normalised, ie to have the top bit of its most significant limb set.
+//
+// bz_divide_3n2n divides a by b, where b is split into a high part b1 of n - lo limbs and a low
+// part b0 of lo limbs, and a < b * 2^(limb_bits * (n - lo)) so the quotient has at most n - lo limbs.
+// The quotient is estimated by dividing the high limbs of a by b1, and is then at most 2 too large:
+//
+template <class CppInt>
+void bz_divide_2n1n(CppInt& q, CppInt& r, const CppInt& a, const CppInt& b);
+
+template <class CppInt>
+inline CppInt bz_high_limbs(const CppInt& x, unsigned n, const limb_type& zero)
+{
+   return x.size() > n ? CppInt(x.limbs(), n, x.size() - n) : CppInt(&zero, 0, 1);
+}
+
+template <class CppInt>
+void bz_divide_3n2n(CppInt& q, CppInt& r, const CppInt& a, const CppInt& b, unsigned lo)
+{
+   unsigned     n    = b.size();
+   unsigned     m    = n - lo;
+   limb_type    zero = 0;
+   const CppInt b1(b.limbs(), lo, m);
+   const CppInt b0(b.limbs(), 0, lo);
+   const CppInt a_hi = bz_high_limbs(a, lo, zero);
+   const CppInt a_lo(a.limbs(), 0, (std::min)(lo, a.size()));
+
+   CppInt r1;
+   if (bz_high_limbs(a_hi, m, zero).compare_unsigned(b1) < 0)
+      bz_divide_2n1n(q, r1, a_hi, b1);
+   else
+   {
+      // The quotient is 2^(limb_bits * m) - 1, with remainder a_hi - q * b1:
+      q.resize(m, m);
+      std::fill(q.limbs(), q.limbs() + m, ~static_cast<limb_type>(0u));
+      r1 = b1;
+      eval_left_shift(r1, m * CppInt::limb_bits);
+      eval_subtract(r1, a_hi, r1);
+      eval_add(r1, b1);
+   }
+   CppInt d;
+   eval_multiply(d, q, b0);
+   r = r1;
+   eval_left_shift(r, lo * CppInt::limb_bits);
+   eval_add(r, a_lo);
+   eval_subtract(r, d);
+   while (r.sign())
+   {
+      eval_add(r, b);
+      eval_decrement(q);
+   }
+}
+//
+// Divides a by b, where a < b * 2^(limb_bits * n) and n = b.size(), by splitting the quotient
+// into 2 halves, each of which is found with bz_divide_3n2n:
+//
+template <class CppInt>
+void bz_divide_2n1n(CppInt& q, CppInt& r, const CppInt& a, const CppInt& b)
+{
+   unsigned n = b.size();
+   if (a.compare_unsigned(b) < 0)
+   {
+      q = static_cast<limb_type>(0u);
+      r = a;
+      return;
+   }
+   if (n < get_cpp_int_tuning().burnikel_ziegler_cutoff)
+   {
+      divide_unsigned_helper(&q, a, b, r);
+      return;
+   }
+   unsigned     lo   = n / 2;
+   limb_type    zero = 0;
+   const CppInt a_hi = bz_high_limbs(a, lo, zero);
+   const CppInt a_lo(a.limbs(), 0, (std::min)(lo, a.size()));
+   CppInt       q1, r1, q0;
+   bz_divide_3n2n(q1, r1, a_hi, b, lo);
+   eval_left_shift(r1, lo * CppInt::limb_bits);
+   eval_add(r1, a_lo);
+   bz_divide_3n2n(q0, r, r1, b, n - lo);
+   q = q1;
+   eval_left_shift(q, lo * CppInt::limb_bits);
+   eval_add(q, q0);
+}
+//
+// Entry point: normalise the divisor, then divide n limbs at a time from the top of the dividend,
+// where n is the size of the divisor.  The magnitudes of x and y are aliased as variable precision
+// values, and only the magnitudes of the results are set, as with divide_unsigned_helper:
+//
+template <class CppInt1, class CppInt2, class CppInt3>
+typename enable_if_c<!is_fixed_precision<CppInt1>::value>::type divide_burnikel_ziegler(CppInt1* result, const CppInt2& x, const CppInt3& y, CppInt1& r)
+{
+   typedef cpp_int_backend<0, 0, signed_magnitude, unchecked, typename CppInt1::allocator_type> cpp_int_type;
+
+   unsigned           shift = cpp_int_type::limb_bits - 1 - boost::multiprecision::detail::find_msb(y.limbs()[y.size() - 1]);
+   const cpp_int_type x_alias(x.limbs(), 0, x.size());
+   const cpp_int_type y_alias(y.limbs(), 0, y.size());
+   cpp_int_type       a, b;
+   a = x_alias;
+   eval_left_shift(a, shift);
+   b = y_alias;
+   eval_left_shift(b, shift);
+
+   unsigned     n      = b.size();
+   unsigned     blocks = (a.size() + n - 1) / n;
+   cpp_int_type q, rem, q_i, t;
+   q.resize(blocks * n, blocks * n);
+   std::fill(q.limbs(), q.limbs() + q.size(), static_cast<limb_type>(0u));
+   //
+   // The top block is less than 2^(limb_bits * n), and therefore than b * 2^(limb_bits * n):
+   //
+   const cpp_int_type top(a.limbs(), (blocks - 1) * n, a.size() - (blocks - 1) * n);
+   bz_divide_2n1n(q_i, rem, top, b);
+   std::copy(q_i.limbs(), q_i.limbs() + q_i.size(), q.limbs() + (blocks - 1) * n);
+   for (unsigned i = blocks - 1; i-- > 0;)
+   {
+      const cpp_int_type a_i(a.limbs(), i * n, n);
+      t = rem;
+      eval_left_shift(t, n * cpp_int_type::limb_bits);
+      eval_add(t, a_i);
+      bz_divide_2n1n(q_i, rem, t, b);
+      std::copy(q_i.limbs(), q_i.limbs() + q_i.size(), q.limbs() + i * n);
+   }
+   q.normalize();
+   eval_right_shift(rem, shift);
+   if (result)
+      *result = q;
+   r = rem;
+}
+//
+// Barrett division, see Menezes, van Oorschot and Vanstone, "Handbook of Applied Cryptography",
+// algorithm 14.42.  y has k limbs and mu = floor(2^(2 * limb_bits * k) / y), which together need
+// no normalisation.  x is divided k limbs at a time from the top (the first step taking up to 2k),
+// and each quotient digit, estimated from the high limbs of the running remainder times mu, is
+// at most 2 too small.  Only the magnitudes of the results are set:
+//
+template <class CppInt>
+void divide_barrett(CppInt* result, const CppInt& x, const CppInt& y, const CppInt& mu, CppInt& r)
+{
+   BOOST_ASSERT((result != &x) && (&r != &x));
+   unsigned k = y.size();
+   if (x.compare_unsigned(y) < 0)
+   {
+      if (result)
+         *result = static_cast<limb_type>(0u);
+      r = x;
+      r.sign(false);
+      return;
+   }
+   unsigned  steps = x.size() > 2 * k ? (x.size() - k - 1) / k : 0;
+   limb_type zero  = 0;
+   CppInt    q, t, q_i, prod;
+   if (result)
+   {
+      q.resize(x.size() + 1, x.size() + 1);
+      std::fill(q.limbs(), q.limbs() + q.size(), static_cast<limb_type>(0u));
+   }
+   const CppInt top = bz_high_limbs(x, steps * k, zero);
+   t = top; // copy, not an alias of x
+   for (unsigned i = steps + 1; i-- > 0;)
+   {
+      eval_multiply(prod, bz_high_limbs(t, k - 1, zero), mu);
+      eval_right_shift(prod, (k + 1) * CppInt::limb_bits);
+      q_i.swap(prod);
+      eval_multiply(prod, q_i, y);
+      eval_subtract(t, prod);
+      while (t.compare_unsigned(y) >= 0)
+      {
+         eval_subtract(t, y);
+         eval_increment(q_i);
+      }
+      if (result)
+         std::copy(q_i.limbs(), q_i.limbs() + q_i.size(), q.limbs() + i * k);
+      if (i)
+      {
+         eval_left_shift(t, k * CppInt::limb_bits);
+         eval_add(t, CppInt(x.limbs(), (i - 1) * k, k));
+      }
+   }
+   if (result)
+   {
+      q.normalize();
+      result->swap(q);
+   }
+   r.swap(t);
+}
+
 template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, unsigned MinBits2, unsigned MaxBits2, cpp_integer_type SignType2, cpp_int_check_type Checked2, class Allocator2, unsigned MinBits3, unsigned MaxBits3, cpp_integer_type SignType3, cpp_int_check_type Checked3, class Allocator3>
 BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits3, MaxBits3, SignType3, Checked3, Allocator3> >::value>::type
 eval_divide(
@@ -642,6 +850,128 @@ eval_modulus(
    result.sign(result.sign());
 }
 
-}}} // namespace boost::multiprecision::backends
+} // namespace backends
+
+//
+// A divisor which is used repeatedly: the reciprocal needed by Barrett division is calculated
+// once up front, after which each division costs 2 multiplications (per quotient digit of the
+// size of the divisor).  Small divisors gain nothing over schoolbook division, and just use it.
+// Results are as for operator/ and operator%, ie the quotient is truncated towards zero:
+//
+template <class Number>
+class divisor;
+
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+class divisor<number<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates> >
+{
+   typedef backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> backend_type;
+   BOOST_STATIC_ASSERT_MSG(!backends::is_fixed_precision<backend_type>::value, "divisor is only available for arbitrary precision integers.");
+
+ public:
+   typedef number<backend_type, ExpressionTemplates> number_type;
+
+   explicit divisor(const number_type& y) : m_value(y), m_magnitude(y.backend())
+   {
+      if (eval_is_zero(m_magnitude))
+         BOOST_THROW_EXCEPTION(std::overflow_error("Integer Division by zero."));
+      m_magnitude.sign(false);
+      //
+      // Decided once: the reciprocal exists only if it's computed here, whatever
+      // the tuning is changed to later:
+      //
+      m_barrett = m_magnitude.size() >= get_cpp_int_tuning().karatsuba_cutoff;
+      if (m_barrett)
+      {
+         backend_type p(static_cast<limb_type>(1u));
+         eval_left_shift(p, 2 * m_magnitude.size() * backend_type::limb_bits);
+         eval_divide(m_reciprocal, p, m_magnitude);
+      }
+   }
+
+   const number_type& value() const { return m_value; }
+   //
+   // Sets q to x / value() and r to x % value():
+   //
+   void divmod(const number_type& x, number_type& q, number_type& r) const
+   {
+      if (!m_barrett)
+      {
+         divide_qr(x, m_value, q, r);
+         return;
+      }
+      if ((&x == &q) || (&x == &r))
+      {
+         number_type t(x);
+         divmod(t, q, r);
+         return;
+      }
+      bool s = x.backend().sign();
+      divide(&q.backend(), x.backend(), r.backend());
+      q.backend().sign(s != m_value.backend().sign());
+      r.backend().sign(s);
+   }
+   void divide(number_type& q, const number_type& x) const
+   {
+      if (!m_barrett)
+      {
+         q = x / m_value;
+         return;
+      }
+      if (&x == &q)
+      {
+         number_type t(x);
+         divide(q, t);
+         return;
+      }
+      backend_type r;
+      divide(&q.backend(), x.backend(), r);
+      q.backend().sign(x.backend().sign() != m_value.backend().sign());
+   }
+   void modulus(number_type& r, const number_type& x) const
+   {
+      if (!m_barrett)
+      {
+         r = x % m_value;
+         return;
+      }
+      if (&x == &r)
+      {
+         number_type t(x);
+         modulus(r, t);
+         return;
+      }
+      bool s = x.backend().sign();
+      divide(static_cast<backend_type*>(0), x.backend(), r.backend());
+      r.backend().sign(s);
+   }
+
+ private:
+   void divide(backend_type* q, const backend_type& x, backend_type& r) const
+   {
+      backends::divide_barrett(q, x, m_magnitude, m_reciprocal, r);
+   }
+
+   number_type  m_value;
+   backend_type m_magnitude, m_reciprocal;
+   bool         m_barrett;
+};
+
+template <class Number>
+inline Number operator/(const Number& x, const divisor<Number>& y)
+{
+   Number result;
+   y.divide(result, x);
+   return result;
+}
+
+template <class Number>
+inline Number operator%(const Number& x, const divisor<Number>& y)
+{
+   Number result;
+   y.modulus(result, x);
+   return result;
+}
+
+}} // namespace boost::multiprecision
 
 #endif
@@ -0,0 +1,316 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Unrolled add, subtract, multiply and compare for small fixed width cpp_int_backend's, ie those
+// with MinBits == MaxBits, such as uint256_t.  The limb count of these is known at compile time,
+// so rather than loop over the used limbs of each argument and then track the size of the result,
+// we treat every value as exactly internal_limb_count limbs (zero extending the arguments) and
+// generate a straight line carry chain for the whole width, normalizing just once at the end.
+//
+#ifndef BOOST_MP_CPP_INT_FIXED_WIDTH_HPP
+#define BOOST_MP_CPP_INT_FIXED_WIDTH_HPP
+
+//
+// Add-with-carry and subtract-with-borrow intrinsics, where we have them, give the compiler
+// the carry chain directly rather than leaving it to spot the pattern in double_limb_type
+// arithmetic.  They can't be used in constant expressions, so are only enabled when we can
+// tell whether we're in one:
+//
+#if !defined(BOOST_MP_NO_ADDCARRY_INTRINSICS) && (!defined(BOOST_MP_NO_CONSTEXPR_DETECTION) || defined(BOOST_NO_CXX14_CONSTEXPR))
+#if defined(BOOST_MSVC) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define BOOST_MP_HAS_ADDCARRY_INTRINSICS
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define BOOST_MP_HAS_ADDCARRY_INTRINSICS
+#endif
+#endif
+
+namespace boost { namespace multiprecision { namespace backends {
+
+//
+// Widest type we generate unrolled code for, beyond this the straight line code
+// gets too large to be worthwhile:
+//
+#ifdef BOOST_MP_FIXED_WIDTH_KERNEL_MAX_BITS
+const unsigned fixed_width_kernel_max_bits = BOOST_MP_FIXED_WIDTH_KERNEL_MAX_BITS;
+#else
+const unsigned fixed_width_kernel_max_bits = 1024;
+#endif
+
+template <class CppInt>
+struct is_fixed_width_cpp_int : public mpl::false_
+{};
+//
+// Checked types have to detect overflow as it happens, so go the long way round:
+//
+template <unsigned Bits, cpp_integer_type SignType>
+struct is_fixed_width_cpp_int<cpp_int_backend<Bits, Bits, SignType, unchecked, void> >
+    : public mpl::bool_<!is_trivial_cpp_int<cpp_int_backend<Bits, Bits, SignType, unchecked, void> >::value && (Bits <= fixed_width_kernel_max_bits)>
+{};
+
+#ifdef BOOST_MP_HAS_ADDCARRY_INTRINSICS
+BOOST_MP_FORCEINLINE unsigned char addcarry_limb(unsigned char carry, limb_type a, limb_type b, limb_type* result)
+{
+#if defined(BOOST_HAS_INT128) && (defined(_M_X64) || defined(__x86_64__))
+   unsigned long long r;
+   carry   = _addcarry_u64(carry, a, b, &r);
+   *result = static_cast<limb_type>(r);
+#else
+   unsigned int r;
+   carry   = _addcarry_u32(carry, a, b, &r);
+   *result = static_cast<limb_type>(r);
+#endif
+   return carry;
+}
+BOOST_MP_FORCEINLINE unsigned char subborrow_limb(unsigned char borrow, limb_type a, limb_type b, limb_type* result)
+{
+#if defined(BOOST_HAS_INT128) && (defined(_M_X64) || defined(__x86_64__))
+   unsigned long long r;
+   borrow  = _subborrow_u64(borrow, a, b, &r);
+   *result = static_cast<limb_type>(r);
+#else
+   unsigned int r;
+   borrow  = _subborrow_u32(borrow, a, b, &r);
+   *result = static_cast<limb_type>(r);
+#endif
+   return borrow;
+}
+#endif
+//
+// Each kernel is a template recursion over limb index I, terminated by a specialization for I == N,
+// which the compiler flattens into straight line code.  Arguments are zero extended beyond their
+// used sizes, limbs there may hold stale values:
+//
+template <unsigned I, unsigned N>
+struct fixed_width_kernel
+{
+   BOOST_STATIC_CONSTANT(unsigned, limb_bits = sizeof(limb_type) * CHAR_BIT);
+   //
+   // Limb I of p, or zero if that's beyond size, we mask rather than branch as the
+   // sizes are unpredictable and a branch would break up the carry chain:
+   //
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR limb_type limb(const limb_type* p, unsigned size) BOOST_NOEXCEPT
+   {
+      return p[I] & (static_cast<limb_type>(0u) - static_cast<limb_type>(I < size));
+   }
+
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR limb_type add(limb_type* pr, const limb_type* pa, unsigned as, const limb_type* pb, unsigned bs, limb_type carry) BOOST_NOEXCEPT
+   {
+      double_limb_type sum = static_cast<double_limb_type>(limb(pa, as)) + limb(pb, bs) + carry;
+      pr[I]                = static_cast<limb_type>(sum);
+      return fixed_width_kernel<I + 1, N>::add(pr, pa, as, pb, bs, static_cast<limb_type>(sum >> limb_bits));
+   }
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR limb_type subtract(limb_type* pr, const limb_type* pa, unsigned as, const limb_type* pb, unsigned bs, limb_type borrow) BOOST_NOEXCEPT
+   {
+      double_limb_type diff = static_cast<double_limb_type>(limb(pa, as)) - limb(pb, bs) - borrow;
+      pr[I]                 = static_cast<limb_type>(diff);
+      return fixed_width_kernel<I + 1, N>::subtract(pr, pa, as, pb, bs, static_cast<limb_type>((diff >> limb_bits) & 1u));
+   }
+#ifdef BOOST_MP_HAS_ADDCARRY_INTRINSICS
+   static BOOST_MP_FORCEINLINE unsigned char add_intrinsic(limb_type* pr, const limb_type* pa, unsigned as, const limb_type* pb, unsigned bs, unsigned char carry) BOOST_NOEXCEPT
+   {
+      carry = addcarry_limb(carry, limb(pa, as), limb(pb, bs), pr + I);
+      return fixed_width_kernel<I + 1, N>::add_intrinsic(pr, pa, as, pb, bs, carry);
+   }
+   static BOOST_MP_FORCEINLINE unsigned char subtract_intrinsic(limb_type* pr, const limb_type* pa, unsigned as, const limb_type* pb, unsigned bs, unsigned char borrow) BOOST_NOEXCEPT
+   {
+      borrow = subborrow_limb(borrow, limb(pa, as), limb(pb, bs), pr + I);
+      return fixed_width_kernel<I + 1, N>::subtract_intrinsic(pr, pa, as, pb, bs, borrow);
+   }
+#endif
+   //
+   // pr = 0 - pr, over all N limbs:
+   //
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR void negate(limb_type* pr, limb_type carry) BOOST_NOEXCEPT
+   {
+      double_limb_type sum = static_cast<double_limb_type>(static_cast<limb_type>(~pr[I])) + carry;
+      pr[I]                = static_cast<limb_type>(sum);
+      fixed_width_kernel<I + 1, N>::negate(pr, static_cast<limb_type>(sum >> limb_bits));
+   }
+   //
+   // Adds ai * pb into pr starting at limb I, discarding everything from limb N up,
+   // J = I - (index of ai) is the index into pb:
+   //
+   template <unsigned J>
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR void multiply_row(limb_type* pr, limb_type ai, const limb_type* pb, unsigned bs, limb_type carry) BOOST_NOEXCEPT
+   {
+      double_limb_type t = static_cast<double_limb_type>(ai) * fixed_width_kernel<J, N>::limb(pb, bs) + pr[I] + carry;
+      pr[I]              = static_cast<limb_type>(t);
+      fixed_width_kernel<I + 1, N>::template multiply_row<J + 1>(pr, ai, pb, bs, static_cast<limb_type>(t >> limb_bits));
+   }
+   //
+   // Adds rows I, I+1, ... N-1 of the product into pr, which must start out zeroed:
+   //
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR void multiply(limb_type* pr, const limb_type* pa, unsigned as, const limb_type* pb, unsigned bs) BOOST_NOEXCEPT
+   {
+      if (I < as)
+      {
+         fixed_width_kernel<I, N>::template multiply_row<0>(pr, pa[I], pb, bs, 0u);
+         fixed_width_kernel<I + 1, N>::multiply(pr, pa, as, pb, bs);
+      }
+   }
+   //
+   // Compares limbs N-1-I down to 0, both arguments must have the same size:
+   //
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR int compare(const limb_type* pa, const limb_type* pb, unsigned size) BOOST_NOEXCEPT
+   {
+      return (N - 1 - I < size) && (pa[N - 1 - I] != pb[N - 1 - I]) ? (pa[N - 1 - I] > pb[N - 1 - I] ? 1 : -1) : fixed_width_kernel<I + 1, N>::compare(pa, pb, size);
+   }
+};
+
+template <unsigned N>
+struct fixed_width_kernel<N, N>
+{
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR limb_type add(limb_type*, const limb_type*, unsigned, const limb_type*, unsigned, limb_type carry) BOOST_NOEXCEPT
+   {
+      return carry;
+   }
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR limb_type subtract(limb_type*, const limb_type*, unsigned, const limb_type*, unsigned, limb_type borrow) BOOST_NOEXCEPT
+   {
+      return borrow;
+   }
+#ifdef BOOST_MP_HAS_ADDCARRY_INTRINSICS
+   static BOOST_MP_FORCEINLINE unsigned char add_intrinsic(limb_type*, const limb_type*, unsigned, const limb_type*, unsigned, unsigned char carry) BOOST_NOEXCEPT
+   {
+      return carry;
+   }
+   static BOOST_MP_FORCEINLINE unsigned char subtract_intrinsic(limb_type*, const limb_type*, unsigned, const limb_type*, unsigned, unsigned char borrow) BOOST_NOEXCEPT
+   {
+      return borrow;
+   }
+#endif
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR void negate(limb_type*, limb_type) BOOST_NOEXCEPT {}
+   template <unsigned J>
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR void multiply_row(limb_type*, limb_type, const limb_type*, unsigned, limb_type) BOOST_NOEXCEPT {}
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR void multiply(limb_type*, const limb_type*, unsigned, const limb_type*, unsigned) BOOST_NOEXCEPT {}
+   static BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR int compare(const limb_type*, const limb_type*, unsigned) BOOST_NOEXCEPT
+   {
+      return 0;
+   }
+};
+//
+// Returns the carry (borrow) out of the top limb:
+//
+template <unsigned N>
+BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR bool fixed_width_add(limb_type* pr, const limb_type* pa, unsigned as, const limb_type* pb, unsigned bs) BOOST_NOEXCEPT
+{
+#ifdef BOOST_MP_HAS_ADDCARRY_INTRINSICS
+#ifndef BOOST_NO_CXX14_CONSTEXPR
+   if (!BOOST_MP_IS_CONST_EVALUATED(as))
+#endif
+      return fixed_width_kernel<0, N>::add_intrinsic(pr, pa, as, pb, bs, 0);
+#endif
+   return fixed_width_kernel<0, N>::add(pr, pa, as, pb, bs, 0u) != 0;
+}
+template <unsigned N>
+BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR bool fixed_width_subtract(limb_type* pr, const limb_type* pa, unsigned as, const limb_type* pb, unsigned bs) BOOST_NOEXCEPT
+{
+#ifdef BOOST_MP_HAS_ADDCARRY_INTRINSICS
+#ifndef BOOST_NO_CXX14_CONSTEXPR
+   if (!BOOST_MP_IS_CONST_EVALUATED(as))
+#endif
+      return fixed_width_kernel<0, N>::subtract_intrinsic(pr, pa, as, pb, bs, 0);
+#endif
+   return fixed_width_kernel<0, N>::subtract(pr, pa, as, pb, bs, 0u) != 0;
+}
+
+//
+// The hooks called from the generic routines: each returns false if the types don't
+// qualify and the generic code should carry on, or true once it has done the work.
+// The result may alias either argument: addition and subtraction read each limb before
+// writing it so may work in place, multiplication builds the result in a temporary:
+//
+template <class CppInt1, class CppInt2, class CppInt3>
+BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR bool add_unsigned_fixed_width(CppInt1&, const CppInt2&, const CppInt3&) BOOST_NOEXCEPT
+{
+   return false;
+}
+template <unsigned Bits, cpp_integer_type SignType>
+BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<is_fixed_width_cpp_int<cpp_int_backend<Bits, Bits, SignType, unchecked, void> >::value, bool>::type
+add_unsigned_fixed_width(cpp_int_backend<Bits, Bits, SignType, unchecked, void>& result, const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& a, const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& b) BOOST_NOEXCEPT
+{
+   typedef cpp_int_backend<Bits, Bits, SignType, unchecked, void> cpp_int_type;
+   const unsigned                                                  n = cpp_int_type::internal_limb_count;
+
+   unsigned as = a.size();
+   unsigned bs = b.size();
+   bool     s  = a.sign();
+   result.resize(n, n);
+   fixed_width_add<n>(result.limbs(), a.limbs(), as, b.limbs(), bs);
+   result.normalize();
+   result.sign(s);
+   return true;
+}
+
+template <class CppInt1, class CppInt2, class CppInt3>
+BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR bool subtract_unsigned_fixed_width(CppInt1&, const CppInt2&, const CppInt3&) BOOST_NOEXCEPT
+{
+   return false;
+}
+template <unsigned Bits, cpp_integer_type SignType>
+BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<is_fixed_width_cpp_int<cpp_int_backend<Bits, Bits, SignType, unchecked, void> >::value, bool>::type
+subtract_unsigned_fixed_width(cpp_int_backend<Bits, Bits, SignType, unchecked, void>& result, const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& a, const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& b) BOOST_NOEXCEPT
+{
+   typedef cpp_int_backend<Bits, Bits, SignType, unchecked, void> cpp_int_type;
+   const unsigned                                                  n = cpp_int_type::internal_limb_count;
+
+   unsigned as = a.size();
+   unsigned bs = b.size();
+   bool     s  = a.sign();
+   result.resize(n, n);
+   if (fixed_width_subtract<n>(result.limbs(), a.limbs(), as, b.limbs(), bs) && (SignType == signed_magnitude))
+   {
+      //
+      // |b| > |a|: for signed types we want the magnitude |b| - |a| with the sign flipped, unsigned
+      // types just wrap around, which is what we already have:
+      //
+      fixed_width_kernel<0, n>::negate(result.limbs(), 1u);
+      s = !s;
+   }
+   result.normalize();
+   result.sign(s);
+   return true;
+}
+
+template <class CppInt1, class CppInt2, class CppInt3>
+BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR bool multiply_fixed_width(CppInt1&, const CppInt2&, const CppInt3&) BOOST_NOEXCEPT
+{
+   return false;
+}
+template <unsigned Bits, cpp_integer_type SignType>
+BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<is_fixed_width_cpp_int<cpp_int_backend<Bits, Bits, SignType, unchecked, void> >::value, bool>::type
+multiply_fixed_width(cpp_int_backend<Bits, Bits, SignType, unchecked, void>& result, const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& a, const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& b) BOOST_NOEXCEPT
+{
+   typedef cpp_int_backend<Bits, Bits, SignType, unchecked, void> cpp_int_type;
+   const unsigned                                                  n = cpp_int_type::internal_limb_count;
+
+   limb_type t[n] = {0};
+   bool      s    = a.sign() != b.sign();
+   fixed_width_kernel<0, n>::multiply(t, a.limbs(), a.size(), b.limbs(), b.size());
+   result.resize(n, n);
+   std_constexpr::copy(t, t + n, result.limbs());
+   result.normalize();
+   result.sign(s);
+   return true;
+}
+
+template <class CppInt1, class CppInt2>
+BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR int compare_unsigned_fixed_width(const CppInt1& a, const CppInt2& b) BOOST_NOEXCEPT
+{
+   return a.compare_unsigned(b);
+}
+template <unsigned Bits, cpp_integer_type SignType>
+BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<is_fixed_width_cpp_int<cpp_int_backend<Bits, Bits, SignType, unchecked, void> >::value, int>::type
+compare_unsigned_fixed_width(const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& a, const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& b) BOOST_NOEXCEPT
+{
+   if (a.size() != b.size())
+      return a.size() > b.size() ? 1 : -1;
+   return fixed_width_kernel<0, cpp_int_backend<Bits, Bits, SignType, unchecked, void>::internal_limb_count>::compare(a.limbs(), b.limbs(), a.size());
+}
+
+}}} // namespace boost::multiprecision::backends
+
+#endif
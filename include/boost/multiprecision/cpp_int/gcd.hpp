@@ -0,0 +1,535 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Lehmer's gcd algorithm and the half-gcd for cpp_int_backend, used by eval_gcd and eval_gcdext.
+//
+// Lehmer's algorithm: see D. E. Knuth, "The Art of Computer Programming", vol. 2, 4.5.2, algorithm L.
+// The first few quotients of the Euclidean algorithm depend only on the leading bits of the arguments,
+// so are found from those alone, in double_limb_type arithmetic, and the resulting 2x2 matrix of single
+// limb cofactors is then applied to the full values in one pass.  We use Jebelean's exact condition for
+// when the quotients found this way are correct, in the same form as CPython's long integer gcd.
+//
+// The half-gcd: see N. Moller, "On Schonhage's algorithm and subquadratic integer gcd computation",
+// Math. Comp. 77 (2008).  The matrix taking a and b about half way to their gcd is found recursively from
+// their top halves, and applied to the full values with fast multiplication.  Rather than Moller's exact
+// bounds we simply correct the signs and order of the values after each matrix is applied: any such
+// matrix has determinant +-1 so the gcd is preserved whatever, and errors are rare and small.
+//
+#ifndef BOOST_MP_CPP_INT_GCD_HPP
+#define BOOST_MP_CPP_INT_GCD_HPP
+
+namespace boost { namespace multiprecision { namespace backends {
+
+//
+// The bits of u from bit "shift" up, as many as fit in a double_limb_type:
+//
+template <class CppInt>
+BOOST_MP_CXX14_CONSTEXPR double_limb_type lehmer_leading_bits(const CppInt& u, unsigned shift)
+{
+   unsigned                            i = shift / CppInt::limb_bits;
+   unsigned                            r = shift % CppInt::limb_bits;
+   unsigned                            n = u.size();
+   typename CppInt::const_limb_pointer p = u.limbs();
+
+   double_limb_type result = (i < n ? p[i] : 0u) | (static_cast<double_limb_type>(i + 1 < n ? p[i + 1] : 0u) << CppInt::limb_bits);
+   result >>= r;
+   if (r && (i + 2 < n))
+      result |= static_cast<double_limb_type>(p[i + 2]) << (2 * CppInt::limb_bits - r);
+   return result;
+}
+//
+// For u >= v > 0, finds the cofactors m for as many steps of the Euclidean algorithm as can be
+// determined from the leading 2 * (limb_bits - 2) bits of u and the corresponding bits of v, such that
+// the values after those steps are m[0] * u + m[1] * v and m[2] * u + m[3] * v.  The cofactors are
+// less than 2^(limb_bits - 2) in magnitude, which leaves room for the sum of two products with a
+// limb in a signed_double_limb_type.  Returns false if not even one quotient could be found:
+//
+template <class CppInt>
+BOOST_MP_CXX14_CONSTEXPR bool lehmer_gcd_cofactors(const CppInt& u, const CppInt& v, signed_limb_type* m)
+{
+   const unsigned         digit_bits   = CppInt::limb_bits - 2;
+   const double_limb_type max_cofactor = static_cast<double_limb_type>(1u) << digit_bits;
+
+   unsigned bits  = (u.size() - 1) * CppInt::limb_bits + boost::multiprecision::detail::find_msb(u.limbs()[u.size() - 1]) + 1;
+   unsigned shift = bits > 2 * digit_bits ? bits - 2 * digit_bits : 0;
+
+   double_limb_type x = lehmer_leading_bits(u, shift);
+   double_limb_type y = lehmer_leading_bits(v, shift);
+   double_limb_type a = 1, b = 0, c = 0, d = 1;
+   unsigned         k = 0;
+   //
+   // x and y are the leading bits of the current pair of values, which are a * u - b * v and d * v - c * u
+   // (or the negations of those when k is odd).  Each quotient q is only accepted if it's the same for
+   // every value the discarded low bits could take, in which case the new cofactors are all positive
+   // and increasing:
+   //
+   for (; y != c; ++k)
+   {
+      double_limb_type num = x + (a - 1);
+      double_limb_type den = y - c;
+      double_limb_type q   = 0;
+      if (num < (den << 3))
+      {
+         // Most quotients are small, and repeated subtraction is then cheaper than a double limb division:
+         while (num >= den)
+         {
+            num -= den;
+            ++q;
+         }
+      }
+      else
+         q = num / den;
+      if (q >= max_cofactor)
+         break;
+      double_limb_type qy = q * y;
+      if (qy > x)
+         break;
+      double_limb_type s = b + q * d;
+      double_limb_type t = x - qy;
+      if (s > t)
+         break;
+      double_limb_type nd = a + q * c;
+      if ((s >= max_cofactor) || (nd >= max_cofactor))
+         break;
+      x = y;
+      y = t;
+      a = d;
+      b = c;
+      c = s;
+      d = nd;
+   }
+   if (!k)
+      return false;
+   if (k & 1)
+   {
+      m[0] = -static_cast<signed_limb_type>(b);
+      m[1] = static_cast<signed_limb_type>(a);
+      m[2] = static_cast<signed_limb_type>(d);
+      m[3] = -static_cast<signed_limb_type>(c);
+   }
+   else
+   {
+      m[0] = static_cast<signed_limb_type>(a);
+      m[1] = -static_cast<signed_limb_type>(b);
+      m[2] = -static_cast<signed_limb_type>(c);
+      m[3] = static_cast<signed_limb_type>(d);
+   }
+   return true;
+}
+//
+// r1 = m[0] * u + m[1] * v and r2 = m[2] * u + m[3] * v, in one pass over the limbs, for non-negative
+// u >= v and cofactors from lehmer_gcd_cofactors, which guarantee non-negative results:
+//
+template <class CppInt>
+BOOST_MP_CXX14_CONSTEXPR void lehmer_gcd_combine(CppInt& r1, CppInt& r2, const CppInt& u, const CppInt& v, const signed_limb_type* m)
+{
+   unsigned n  = u.size();
+   unsigned vn = v.size();
+   r1.resize(n, n);
+   r2.resize(n, n);
+   typename CppInt::const_limb_pointer pu = u.limbs();
+   typename CppInt::const_limb_pointer pv = v.limbs();
+   typename CppInt::limb_pointer       p1 = r1.limbs();
+   typename CppInt::limb_pointer       p2 = r2.limbs();
+
+   signed_double_limb_type carry1 = 0, carry2 = 0;
+   for (unsigned i = 0; i < n; ++i)
+   {
+      signed_double_limb_type ui = pu[i];
+      signed_double_limb_type vi = i < vn ? pv[i] : 0u;
+      carry1 += m[0] * ui + m[1] * vi;
+      carry2 += m[2] * ui + m[3] * vi;
+      p1[i] = static_cast<limb_type>(carry1);
+      p2[i] = static_cast<limb_type>(carry2);
+      carry1 >>= CppInt::limb_bits;
+      carry2 >>= CppInt::limb_bits;
+   }
+   BOOST_ASSERT((carry1 == 0) && (carry2 == 0));
+   r1.sign(false);
+   r2.sign(false);
+   r1.normalize();
+   r2.normalize();
+}
+//
+// Converts r from two's complement (negative if the carry out of the top limb was) to sign-magnitude:
+//
+template <class CppInt>
+void gcd_signed_combine_finish(CppInt& r, bool negative)
+{
+   if (negative)
+   {
+      typename CppInt::limb_pointer p     = r.limbs();
+      limb_type                     carry = 1;
+      for (unsigned i = 0; i < r.size(); ++i)
+      {
+         p[i]  = static_cast<limb_type>(~p[i]) + carry;
+         carry = carry && !p[i];
+      }
+   }
+   r.sign(false);
+   r.normalize();
+   if (negative)
+      r.negate();
+}
+//
+// As above but for signed values of any size, as needed for the cofactors themselves, which have
+// mixed signs.  The sum is formed in two's complement, and negated at the end if it's negative:
+//
+template <class CppInt>
+void gcd_signed_combine(CppInt& r1, CppInt& r2, const CppInt& x, const CppInt& y, const signed_limb_type* m)
+{
+   unsigned xn = x.size();
+   unsigned yn = y.size();
+   unsigned n  = (std::max)(xn, yn) + 1;
+   r1.resize(n, n);
+   r2.resize(n, n);
+   typename CppInt::const_limb_pointer px = x.limbs();
+   typename CppInt::const_limb_pointer py = y.limbs();
+   typename CppInt::limb_pointer       p1 = r1.limbs();
+   typename CppInt::limb_pointer       p2 = r2.limbs();
+
+   signed_limb_type        c[4]   = {x.sign() ? -m[0] : m[0], y.sign() ? -m[1] : m[1], x.sign() ? -m[2] : m[2], y.sign() ? -m[3] : m[3]};
+   signed_double_limb_type carry1 = 0, carry2 = 0;
+   for (unsigned i = 0; i < n; ++i)
+   {
+      signed_double_limb_type xi = i < xn ? px[i] : 0u;
+      signed_double_limb_type yi = i < yn ? py[i] : 0u;
+      carry1 += c[0] * xi + c[1] * yi;
+      carry2 += c[2] * xi + c[3] * yi;
+      p1[i] = static_cast<limb_type>(carry1);
+      p2[i] = static_cast<limb_type>(carry2);
+      carry1 >>= CppInt::limb_bits;
+      carry2 >>= CppInt::limb_bits;
+   }
+   gcd_signed_combine_finish(r1, carry1 < 0);
+   gcd_signed_combine_finish(r2, carry2 < 0);
+}
+
+//
+// Replaces u >= v > 0 by the values several steps of the Euclidean algorithm on, returning the cofactors
+// used in m, or returns false without changing anything if no step could be found.  t1 and t2 are scratch:
+//
+template <class CppInt>
+BOOST_MP_CXX14_CONSTEXPR bool lehmer_gcd_step(CppInt& u, CppInt& v, CppInt& t1, CppInt& t2, signed_limb_type* m)
+{
+   if (!lehmer_gcd_cofactors(u, v, m))
+      return false;
+   lehmer_gcd_combine(t1, t2, u, v, m);
+   u.swap(t1);
+   v.swap(t2);
+   return true;
+}
+//
+// Reduces u >= v > 0 until v has no more than 2 limbs, so that what's left can be finished off in
+// double_limb_type arithmetic:
+//
+template <class CppInt>
+BOOST_MP_CXX14_CONSTEXPR void lehmer_gcd(CppInt& u, CppInt& v)
+{
+   CppInt           t1, t2;
+   signed_limb_type m[4] = {0, 0, 0, 0};
+   while (v.size() > 2)
+   {
+      if (!lehmer_gcd_step(u, v, t1, t2, m))
+      {
+         // v is much smaller than u, take a full division step:
+         eval_modulus(t1, u, v);
+         u.swap(v);
+         v.swap(t1);
+      }
+   }
+}
+
+//
+// The matrix of cofactors taking the arguments of a gcd to the current values, so that u = m[0][0] * a + m[0][1] * b
+// and v = m[1][0] * a + m[1][1] * b.  For the extended gcd we only need the first column, the cofactors of a:
+//
+template <class CppInt>
+struct gcd_matrix
+{
+   explicit gcd_matrix(unsigned cols) : columns(cols)
+   {
+      set_identity();
+   }
+   void set_identity()
+   {
+      for (unsigned j = 0; j < columns; ++j)
+      {
+         m[0][j] = static_cast<limb_type>(j == 0 ? 1u : 0u);
+         m[1][j] = static_cast<limb_type>(j == 1 ? 1u : 0u);
+      }
+   }
+   void swap(gcd_matrix& o)
+   {
+      BOOST_ASSERT(columns == o.columns);
+      for (unsigned j = 0; j < columns; ++j)
+      {
+         m[0][j].swap(o.m[0][j]);
+         m[1][j].swap(o.m[1][j]);
+      }
+   }
+   void swap_rows()
+   {
+      for (unsigned j = 0; j < columns; ++j)
+         m[0][j].swap(m[1][j]);
+   }
+   void negate_row(unsigned i)
+   {
+      for (unsigned j = 0; j < columns; ++j)
+         m[i][j].negate();
+   }
+   //
+   // Left multiplies by the cofactors from lehmer_gcd_cofactors:
+   //
+   void apply(const signed_limb_type* l)
+   {
+      for (unsigned j = 0; j < columns; ++j)
+      {
+         gcd_signed_combine(t1, t2, m[0][j], m[1][j], l);
+         m[0][j].swap(t1);
+         m[1][j].swap(t2);
+      }
+   }
+   //
+   // Left multiplies by [[0, 1], [1, -q]], for a division step with quotient q:
+   //
+   void apply(const CppInt& q)
+   {
+      for (unsigned j = 0; j < columns; ++j)
+      {
+         eval_multiply(t1, q, m[1][j]);
+         eval_subtract(m[0][j], t1);
+         m[0][j].swap(m[1][j]);
+      }
+   }
+   //
+   // Left multiplies by the 2x2 matrix l:
+   //
+   void apply(const gcd_matrix& l)
+   {
+      BOOST_ASSERT(l.columns == 2);
+      for (unsigned j = 0; j < columns; ++j)
+      {
+         eval_multiply(t1, l.m[0][0], m[0][j]);
+         eval_multiply(t3, l.m[0][1], m[1][j]);
+         eval_add(t1, t3);
+         eval_multiply(t2, l.m[1][0], m[0][j]);
+         eval_multiply(t3, l.m[1][1], m[1][j]);
+         eval_add(t2, t3);
+         m[0][j].swap(t1);
+         m[1][j].swap(t2);
+      }
+   }
+   //
+   // Sets (a, b) to this times (a, b), then restores a >= b >= 0, updating this to match.  hi_a and hi_b
+   // are the parts of a and b above limb p, already multiplied by this (they're destroyed), so that
+   // only the low p limbs of each need multiplying here:
+   //
+   void transform(CppInt& a, CppInt& b, CppInt& hi_a, CppInt& hi_b, unsigned p)
+   {
+      BOOST_ASSERT(columns == 2);
+      if (a.size() > p)
+      {
+         a.resize(p, p);
+         a.normalize();
+      }
+      if (b.size() > p)
+      {
+         b.resize(p, p);
+         b.normalize();
+      }
+      eval_multiply(t1, m[0][0], a);
+      eval_multiply(t3, m[0][1], b);
+      eval_add(t1, t3);
+      eval_multiply(t2, m[1][0], a);
+      eval_multiply(t3, m[1][1], b);
+      eval_add(t2, t3);
+      eval_left_shift(hi_a, p * CppInt::limb_bits);
+      eval_left_shift(hi_b, p * CppInt::limb_bits);
+      eval_add(t1, hi_a);
+      eval_add(t2, hi_b);
+      a.swap(t1);
+      b.swap(t2);
+      if (a.sign())
+      {
+         a.negate();
+         negate_row(0);
+      }
+      if (b.sign())
+      {
+         b.negate();
+         negate_row(1);
+      }
+      if (a.compare_unsigned(b) < 0)
+      {
+         a.swap(b);
+         swap_rows();
+      }
+   }
+
+   CppInt   m[2][2];
+   unsigned columns;
+
+ private:
+   CppInt t1, t2, t3;
+};
+//
+// One step of Lehmer's algorithm on u >= v > 0, or a division step if that fails, with the cofactors
+// accumulated in c if it's not null:
+//
+template <class CppInt>
+void gcd_step(CppInt& u, CppInt& v, gcd_matrix<CppInt>* c, CppInt& t1, CppInt& t2)
+{
+   signed_limb_type m[4] = {0, 0, 0, 0};
+   if (lehmer_gcd_step(u, v, t1, t2, m))
+   {
+      if (c)
+         c->apply(m);
+   }
+   else if (c)
+   {
+      divide_unsigned_helper(&t2, u, v, t1);
+      u.swap(v);
+      v.swap(t1);
+      c->apply(t2);
+   }
+   else
+   {
+      eval_modulus(t1, u, v);
+      u.swap(v);
+      v.swap(t1);
+   }
+}
+//
+// Half gcd: reduces a >= b >= 0 of n limbs until b has no more than n / 2 + 1 limbs, setting m to the
+// matrix taking the old values to the new if it's not null.  The first half of the reduction comes from
+// the top half of the values, and the second from the top of what's left, each found recursively.
+// Lehmer's algorithm finishes off, and does all the work below the cutoff:
+//
+template <class CppInt>
+void half_gcd(CppInt& a, CppInt& b, gcd_matrix<CppInt>* m)
+{
+   unsigned n = a.size();
+   unsigned s = n / 2 + 1;
+   if (m)
+      m->set_identity();
+   if (b.size() <= s)
+      return;
+
+   if (n >= get_cpp_int_tuning().hgcd_cutoff)
+   {
+      unsigned           p = n / 2;
+      CppInt             a1(a), b1(b);
+      gcd_matrix<CppInt> m1(2);
+      eval_right_shift(a1, p * CppInt::limb_bits);
+      eval_right_shift(b1, p * CppInt::limb_bits);
+      half_gcd(a1, b1, &m1);
+      m1.transform(a, b, a1, b1, p);
+
+      if (b.size() > s)
+      {
+         //
+         // a now has around 3n/4 limbs, reducing the top 2(a.size() - s) - 1 of them by half takes b
+         // down to about s limbs:
+         //
+         p = 2 * s - a.size() + 1;
+         gcd_matrix<CppInt> m2(2);
+         a1 = a;
+         b1 = b;
+         eval_right_shift(a1, p * CppInt::limb_bits);
+         eval_right_shift(b1, p * CppInt::limb_bits);
+         half_gcd(a1, b1, &m2);
+         m2.transform(a, b, a1, b1, p);
+         if (m)
+            m1.apply(m2);
+      }
+      if (m)
+         m->swap(m1);
+   }
+   CppInt t1, t2;
+   while (b.size() > s)
+      gcd_step(a, b, m, t1, t2);
+}
+//
+// Reduces a >= b > 0 with the half gcd while b is above the cutoff, accumulating the cofactors in c if it's not null:
+//
+template <class CppInt>
+void half_gcd_reduce(CppInt& a, CppInt& b, gcd_matrix<CppInt>* c)
+{
+   gcd_matrix<CppInt> m(2);
+   CppInt             t1, t2;
+   while (b.size() >= get_cpp_int_tuning().hgcd_cutoff)
+   {
+      if (b.size() > a.size() / 2 + 1)
+      {
+         half_gcd(a, b, c ? &m : 0);
+         if (c)
+            c->apply(m);
+      }
+      else
+         gcd_step(a, b, c, t1, t2);
+   }
+}
+//
+// Entry point from eval_gcd, for u >= v > 0, which brings v down below the half gcd cutoff,
+// the work is done in the variable precision working type:
+//
+template <class CppInt>
+typename enable_if_c<!is_fixed_precision<CppInt>::value>::type half_gcd_reduce(CppInt& u, CppInt& v)
+{
+   typedef typename unbounded_working_type<CppInt>::type working_type;
+   if (v.size() < get_cpp_int_tuning().hgcd_cutoff)
+      return;
+   working_type a(u), b(v);
+   half_gcd_reduce(a, b, static_cast<gcd_matrix<working_type>*>(0));
+   u = a;
+   v = b;
+}
+template <class CppInt>
+BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<is_fixed_precision<CppInt>::value>::type half_gcd_reduce(CppInt&, CppInt&) {}
+
+//
+// Extended gcd: sets g = gcd(a, b) and s and t such that s * a + t * b = g, with the
+// cofactors normalised as described in default_ops::eval_gcdext_cofactors:
+//
+template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value>::type
+eval_gcdext(
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& b,
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       g,
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       s,
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       t)
+{
+   typedef typename unbounded_working_type<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::type working_type;
+
+   working_type wa(a), wb(b), u(a), v(b), ws, wt, t1, t2;
+   u.sign(false);
+   v.sign(false);
+   //
+   // We track only the cofactors of |a|, and recover those of |b| at the end:
+   //
+   gcd_matrix<working_type> c(1);
+   if (u.compare_unsigned(v) < 0)
+   {
+      u.swap(v);
+      c.swap_rows();
+   }
+   if (!eval_is_zero(v))
+   {
+      half_gcd_reduce(u, v, &c);
+      while (!eval_is_zero(v))
+         gcd_step(u, v, &c, t1, t2);
+   }
+   ws.swap(c.m[0][0]);
+   default_ops::eval_gcdext_cofactors(wa, wb, u, ws, wt);
+   g = u;
+   s = ws;
+   t = wt;
+}
+
+}}} // namespace boost::multiprecision::backends
+
+#endif
@@ -133,6 +133,7 @@ import_bits_fast(
    result.resize(static_cast<unsigned>(limb_len), static_cast<unsigned>(limb_len)); // checked types may throw here if they're not large enough to hold the data!
    result.limbs()[result.size() - 1] = 0u;
    std::memcpy(result.limbs(), i, (std::min)(byte_len, result.size() * sizeof(limb_type)));
+   result.sign(false);
    result.normalize(); // In case data has leading zeros.
    return val;
 }
@@ -149,9 +150,41 @@ import_bits_fast(
    result.limbs()[0] = 0u;
    result.resize(static_cast<unsigned>(limb_len), static_cast<unsigned>(limb_len)); // checked types may throw here if they're not large enough to hold the data!
    std::memcpy(result.limbs(), i, (std::min)(byte_len, result.size() * sizeof(result.limbs()[0])));
+   result.sign(false);
    result.normalize(); // In case data has leading zeros.
    return val;
 }
+//
+// Import of whole limbs, most significant first: the same as import_bits_fast except that the
+// limbs are copied in reverse order, which works whatever the byte order of the platform:
+//
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates, class T>
+number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>&
+import_limbs_msv_first(
+    number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>& val, T* i, T* j)
+{
+   cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& result   = val.backend();
+   unsigned                                                         limb_len = static_cast<unsigned>(j - i);
+   result.limbs()[0]                                                         = 0u;
+   if (limb_len)
+   {
+      result.resize(limb_len, limb_len); // checked types may throw here if they're not large enough to hold the data!
+      std::reverse_copy(j - result.size(), j, result.limbs());
+   }
+   result.sign(false);
+   result.normalize(); // In case data has leading zeros.
+   return val;
+}
+//
+// Export of whole limbs needs no shifting or masking, so we just copy them out:
+//
+template <class Backend, class OutputIterator>
+inline OutputIterator export_limbs(const Backend& val, OutputIterator out, bool msv_first)
+{
+   if (msv_first)
+      return std::reverse_copy(val.limbs(), val.limbs() + val.size(), out);
+   return std::copy(val.limbs(), val.limbs() + val.size(), out);
+}
 } // namespace detail
 
 template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates, class Iterator>
@@ -167,10 +200,20 @@ inline number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, E
 import_bits(
     number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>& val, T* i, T* j, unsigned chunk_size = 0, bool msv_first = true)
 {
+   //
+   // If each element is a whole chunk, then the data is laid out either exactly as our limbs are,
+   // or as our limbs are in reverse order, and can be copied straight in:
+   //
+   unsigned chunk_bits = chunk_size ? chunk_size : std::numeric_limits<typename boost::remove_cv<T>::type>::digits;
+   if (chunk_bits == sizeof(T) * CHAR_BIT)
+   {
 #if BOOST_ENDIAN_LITTLE_BYTE
-   if (((chunk_size % CHAR_BIT) == 0) && !msv_first)
-      return detail::import_bits_fast(val, i, j, chunk_size);
+      if (!msv_first)
+         return detail::import_bits_fast(val, i, j, chunk_size);
 #endif
+      if (msv_first && (sizeof(T) == sizeof(limb_type)) && !boost::multiprecision::backends::is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::value)
+         return detail::import_limbs_msv_first(val, i, j);
+   }
    return detail::import_bits_generic(val, i, j, chunk_size, msv_first);
 }
 
@@ -218,6 +261,8 @@ OutputIterator export_bits(
       ++out;
       return out;
    }
+   if ((chunk_size == sizeof(limb_type) * CHAR_BIT) && !tag_type::value)
+      return detail::export_limbs(val.backend(), out, msv_first);
    unsigned bitcount = boost::multiprecision::backends::eval_msb_imp(val.backend()) + 1;
    unsigned chunks   = bitcount / chunk_size;
    if (bitcount % chunk_size)
@@ -241,6 +286,64 @@ OutputIterator export_bits(
 #endif
 }
 
+//
+// A read only cpp_int whose limbs, least significant first, belong to someone else - a memory mapped
+// file for example - and are used in place rather than copied.  The view converts to a const
+// reference to the integer type, so may be passed to any operation which reads an integer; the
+// limbs must outlive the view and must not change while it's in use.  Copying the value out of the
+// view copies the limbs, only copies of the view itself share them:
+//
+template <class Integer = cpp_int>
+class cpp_int_view;
+
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+class cpp_int_view<number<cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>, ExpressionTemplates> >
+{
+   typedef cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> backend_type;
+   //
+   // Only unbounded types are able to refer to storage they don't own:
+   //
+   BOOST_STATIC_ASSERT_MSG(boost::multiprecision::backends::max_precision<backend_type>::value == UINT_MAX, "cpp_int_view requires an arbitrary precision integer type.");
+
+ public:
+   typedef number<backend_type, ExpressionTemplates> value_type;
+
+   cpp_int_view(const limb_type* limbs, std::size_t count, bool negative = false)
+   {
+      init(limbs, count, negative);
+   }
+   cpp_int_view(const cpp_int_view& o)
+   {
+      init(o.data(), o.size(), o.m_value.backend().sign());
+   }
+   cpp_int_view& operator=(const cpp_int_view& o)
+   {
+      if (this != &o)
+         init(o.data(), o.size(), o.m_value.backend().sign());
+      return *this;
+   }
+
+   const value_type& value() const BOOST_NOEXCEPT { return m_value; }
+   operator const value_type&() const BOOST_NOEXCEPT { return m_value; }
+   //
+   // The limbs in use, which exclude any high order zeros in the original array:
+   //
+   const limb_type* data() const BOOST_NOEXCEPT { return m_value.backend().limbs(); }
+   std::size_t      size() const BOOST_NOEXCEPT { return m_value.backend().size(); }
+
+ private:
+   void init(const limb_type* limbs, std::size_t count, bool negative)
+   {
+      static const limb_type zero = 0;
+      BOOST_ASSERT(count <= UINT_MAX);
+      backend_type alias(count ? limbs : &zero, 0, count ? static_cast<unsigned>(count) : 1u);
+      alias.sign(negative);
+      m_value.backend().swap(alias); // whatever we referred to before goes out of scope with alias
+   }
+
+   value_type m_value;
+};
+
 }
 } // namespace boost::multiprecision
 
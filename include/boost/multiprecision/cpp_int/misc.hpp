@@ -385,6 +385,9 @@ BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR limb_type eval_gcd(limb_type u, li
 
 inline BOOST_MP_CXX14_CONSTEXPR double_limb_type eval_gcd(double_limb_type u, double_limb_type v)
 {
+   // boundary cases
+   if (!u || !v)
+      return u | v;
 #if (__cpp_lib_gcd_lcm >= 201606L) && (!defined(BOOST_HAS_INT128) || !defined(__STRICT_ANSI__))
    return std::gcd(u, v);
 #else
@@ -531,62 +534,32 @@ eval_gcd(
       return;
    }
 
-   /* Let shift := lg K, where K is the greatest power of 2
-   dividing both u and v. */
-
-   unsigned us    = eval_lsb(u);
-   unsigned vs    = eval_lsb(v);
-   int      shift = (std::min)(us, vs);
-   eval_right_shift(u, us);
-   eval_right_shift(v, vs);
-
-   do
+   if (u.compare_unsigned(v) < 0)
+      u.swap(v);
+   //
+   // Large values are first brought down to size with the half gcd, then Lehmer's
+   // algorithm takes v down to no more than 2 limbs:
+   //
+   half_gcd_reduce(u, v);
+   lehmer_gcd(u, v);
+   if (eval_is_zero(v))
    {
-      /* Now u and v are both odd, so diff(u, v) is even.
-      Let u = min(u, v), v = diff(u, v)/2. */
-      s = u.compare(v);
-      if (s > 0)
-         u.swap(v);
-      if (s == 0)
-         break;
-
-      while(((u.size() + 2 < v.size()) && (v.size() * 100 / u.size() > 105)) || ((u.size() <= 2) && (v.size() > 4)))
-      {
-         //
-         // Speical case: if u and v differ considerably in size, then a Euclid step
-         // is more efficient as we reduce v by several limbs in one go.
-         // Unfortunately it requires an expensive long division:
-         //
-         eval_modulus(v, v, u);
-         u.swap(v);
-      }
-      if (v.size() <= 2)
-      {
-         //
-         // Special case: if v has no more than 2 limbs
-         // then we can reduce u and v to a pair of integers and perform
-         // direct integer gcd:
-         //
-         if (v.size() == 1)
-            u = eval_gcd(*v.limbs(), *u.limbs());
-         else
-         {
-            double_limb_type i = v.limbs()[0] | (static_cast<double_limb_type>(v.limbs()[1]) << sizeof(limb_type) * CHAR_BIT);
-            double_limb_type j = (u.size() == 1) ? *u.limbs() : u.limbs()[0] | (static_cast<double_limb_type>(u.limbs()[1]) << sizeof(limb_type) * CHAR_BIT);
-            u                  = eval_gcd(i, j);
-         }
-         break;
-      }
-      //
-      // Regular binary gcd case:
-      //
-      eval_subtract(v, u);
-      vs = eval_lsb(v);
-      eval_right_shift(v, vs);
-   } while (true);
-
-   result = u;
-   eval_left_shift(result, shift);
+      result = u;
+      return;
+   }
+   //
+   // Now we can reduce u and v to a pair of integers and perform
+   // direct integer gcd:
+   //
+   eval_modulus(u, u, v);
+   if (v.size() == 1)
+      result = eval_gcd(*v.limbs(), *u.limbs());
+   else
+   {
+      double_limb_type i = v.limbs()[0] | (static_cast<double_limb_type>(v.limbs()[1]) << sizeof(limb_type) * CHAR_BIT);
+      double_limb_type j = (u.size() == 1) ? *u.limbs() : u.limbs()[0] | (static_cast<double_limb_type>(u.limbs()[1]) << sizeof(limb_type) * CHAR_BIT);
+      result             = eval_gcd(i, j);
+   }
 }
 //
 // Now again for trivial backends:
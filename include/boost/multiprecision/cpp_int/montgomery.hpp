@@ -0,0 +1,238 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Montgomery multiplication and modular exponentiation for cpp_int_backend.
+//
+// See P. L. Montgomery, "Modular Multiplication Without Trial Division", Math. Comp. 44 (1985),
+// and for the word-by-word reduction, Menezes, van Oorschot and Vanstone, "Handbook of Applied
+// Cryptography", algorithm 14.32.  With an odd modulus n of k limbs, and R = 2^(limb_bits * k),
+// values are held as x * R mod n, so that the product of two of them needs only to be divided
+// by R (a shift) rather than reduced modulo n (a division).
+//
+#ifndef BOOST_MP_CPP_INT_MONTGOMERY_HPP
+#define BOOST_MP_CPP_INT_MONTGOMERY_HPP
+
+#include <vector>
+
+namespace boost { namespace multiprecision { namespace backends {
+
+//
+// Exponents with fewer bits than this aren't worth the conversion into and out of Montgomery form:
+//
+#ifdef BOOST_MP_MONTGOMERY_MIN_EXPONENT_BITS
+const unsigned montgomery_min_exponent_bits = BOOST_MP_MONTGOMERY_MIN_EXPONENT_BITS;
+#else
+const unsigned montgomery_min_exponent_bits = 8;
+#endif
+
+//
+// Holds an odd modulus n > 1, -n^-1 mod 2^limb_bits, and R^2 mod n.  All arithmetic is carried out
+// in the variable precision type CppInt regardless of the type of the values, and the temporaries
+// are kept between calls, so a context should not be shared between threads:
+//
+template <class CppInt>
+class montgomery_context
+{
+ public:
+   template <class CppInt2>
+   explicit montgomery_context(const CppInt2& n) : m_modulus(n)
+   {
+      m_modulus.sign(false);
+      BOOST_ASSERT((m_modulus.limbs()[0] & 1u) && ((m_modulus.size() > 1) || (m_modulus.limbs()[0] > 1)));
+      //
+      // Newton iteration for the inverse of the low limb modulo 2^limb_bits, each step
+      // doubles the number of correct bits, starting from 3 (as n * n = 1 mod 8 for odd n):
+      //
+      limb_type n0  = m_modulus.limbs()[0];
+      limb_type inv = n0;
+      for (unsigned bits = 3; bits < CppInt::limb_bits; bits *= 2)
+         inv *= static_cast<limb_type>(2u) - n0 * inv;
+      m_n_prime = static_cast<limb_type>(0u) - inv;
+
+      CppInt r(static_cast<limb_type>(1u));
+      eval_left_shift(r, 2 * size() * CppInt::limb_bits);
+      eval_modulus(m_r2, r, m_modulus);
+   }
+
+   const CppInt& modulus() const { return m_modulus; }
+   unsigned      size() const { return m_modulus.size(); }
+   //
+   // r = a * R mod n, for 0 <= a < n:
+   //
+   void to_montgomery(CppInt& r, const CppInt& a)
+   {
+      multiply(r, a, m_r2);
+   }
+   //
+   // r = a / R mod n:
+   //
+   void from_montgomery(CppInt& r, const CppInt& a)
+   {
+      m_temp = a;
+      redc(r);
+   }
+   //
+   // r = a * b / R mod n, r may alias a or b:
+   //
+   void multiply(CppInt& r, const CppInt& a, const CppInt& b)
+   {
+      eval_multiply(m_temp, a, b);
+      redc(r);
+   }
+   void square(CppInt& r, const CppInt& a)
+   {
+      eval_multiply(m_temp, a, a);
+      redc(r);
+   }
+
+ private:
+   //
+   // Sets r to m_temp / R mod n, for m_temp < n * R.  Each step clears the lowest remaining limb
+   // of m_temp by adding a multiple of n, the total added is less than n * R, so the result
+   // occupies at most 2k + 1 limbs, and the top k + 1 of them are less than 2n:
+   //
+   void redc(CppInt& r)
+   {
+      unsigned k    = size();
+      unsigned used = m_temp.size();
+      m_temp.resize(2 * k + 1, 2 * k + 1);
+      typename CppInt::limb_pointer       pt = m_temp.limbs();
+      typename CppInt::const_limb_pointer pn = m_modulus.limbs();
+      std::fill(pt + used, pt + 2 * k + 1, static_cast<limb_type>(0u));
+
+      for (unsigned i = 0; i < k; ++i)
+      {
+         limb_type        m     = pt[i] * m_n_prime;
+         double_limb_type carry = 0;
+         for (unsigned j = 0; j < k; ++j)
+         {
+            carry += static_cast<double_limb_type>(m) * pn[j] + pt[i + j];
+            pt[i + j] = static_cast<limb_type>(carry);
+            carry >>= CppInt::limb_bits;
+         }
+         for (unsigned j = i + k; carry; ++j)
+         {
+            BOOST_ASSERT(j < 2 * k + 1);
+            carry += pt[j];
+            pt[j] = static_cast<limb_type>(carry);
+            carry >>= CppInt::limb_bits;
+         }
+      }
+      std::copy(pt + k, pt + 2 * k + 1, pt);
+      m_temp.resize(k + 1, k + 1);
+      m_temp.normalize();
+      if (m_temp.compare_unsigned(m_modulus) >= 0)
+         eval_subtract(m_temp, m_modulus);
+      r.swap(m_temp);
+   }
+
+   CppInt    m_modulus, m_r2, m_temp;
+   limb_type m_n_prime;
+};
+//
+// Sets result to a^p mod n, using sliding window exponentiation in Montgomery form, where
+// 0 <= a < n and p > 0:
+//
+template <class CppInt>
+void montgomery_powm(CppInt& result, const CppInt& a, const CppInt& p, montgomery_context<CppInt>& ctx)
+{
+   unsigned bits   = eval_msb(p) + 1;
+   unsigned window = bits > 671 ? 6 : bits > 239 ? 5 : bits > 79 ? 4 : bits > 23 ? 3 : 2;
+   //
+   // Odd powers a, a^3, ... a^(2^window - 1):
+   //
+   std::vector<CppInt> powers(static_cast<std::size_t>(1u) << (window - 1));
+   CppInt              a2;
+   ctx.to_montgomery(powers[0], a);
+   ctx.square(a2, powers[0]);
+   for (std::size_t i = 1; i < powers.size(); ++i)
+      ctx.multiply(powers[i], powers[i - 1], a2);
+
+   CppInt x;
+   bool   started = false;
+   for (int i = static_cast<int>(bits) - 1; i >= 0;)
+   {
+      if (!eval_bit_test(p, i))
+      {
+         ctx.square(x, x);
+         --i;
+         continue;
+      }
+      //
+      // The longest run of up to window bits starting at bit i and ending in a 1:
+      //
+      int low = (std::max)(i - static_cast<int>(window) + 1, 0);
+      while (!eval_bit_test(p, low))
+         ++low;
+      limb_type value = 0;
+      for (int j = i; j >= low; --j)
+         value = (value << 1) | (eval_bit_test(p, j) ? 1u : 0u);
+      if (started)
+      {
+         for (int j = i; j >= low; --j)
+            ctx.square(x, x);
+         ctx.multiply(x, x, powers[value >> 1]);
+      }
+      else
+      {
+         x       = powers[value >> 1];
+         started = true;
+      }
+      i = low - 1;
+   }
+   ctx.from_montgomery(result, x);
+}
+
+//
+// powm for an odd modulus: the arithmetic is carried out in a variable precision type whatever
+// the type of the arguments, and the result takes the sign of a^p, as with the truncating modulus
+// used elsewhere:
+//
+template <class CppInt>
+void eval_powm_montgomery(CppInt& result, const CppInt& a, const CppInt& p, const CppInt& c)
+{
+   typedef typename unbounded_working_type<CppInt>::type working_type;
+
+   montgomery_context<working_type> ctx(c);
+   working_type                     x(a), y, q(p);
+   bool                             negative = a.sign() && eval_bit_test(p, 0);
+   x.sign(false);
+   if (x.compare_unsigned(ctx.modulus()) >= 0)
+      eval_modulus(x, ctx.modulus());
+   montgomery_powm(y, x, q, ctx);
+   result = y;
+   if (negative && !eval_is_zero(result))
+      result.negate();
+}
+
+template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value>::type
+eval_powm(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& p,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& c)
+{
+   //
+   // Montgomery form needs an odd modulus, and isn't available in constant expressions.  Single limb
+   // moduli are reduced quickly enough already.  Otherwise we use the generic square-and-multiply-and-reduce:
+   //
+   bool use_montgomery = (c.limbs()[0] & 1u) && (c.size() > 1) && !p.sign() && !eval_is_zero(p) && (eval_msb_imp(p) + 1 >= montgomery_min_exponent_bits);
+#ifdef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (is_fixed_precision<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value)
+      use_montgomery = false;
+#else
+   if (is_fixed_precision<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value && BOOST_MP_IS_CONST_EVALUATED(use_montgomery))
+      use_montgomery = false;
+#endif
+   if (use_montgomery)
+      eval_powm_montgomery(result, a, p, c);
+   else
+      default_ops::eval_powm(result, a, p, c);
+}
+
+}}} // namespace boost::multiprecision::backends
+
+#endif
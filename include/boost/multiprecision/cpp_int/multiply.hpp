@@ -28,6 +28,7 @@ eval_multiply(
     const cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>& a,
     const limb_type&                                                            val) BOOST_MP_NOEXCEPT_IF((is_non_throwing_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value))
 {
+   BOOST_MP_INSTRUMENT_COUNT_RUNTIME(counter_multiply_limb, val);
    if (!val)
    {
       result = static_cast<limb_type>(0);
@@ -76,14 +77,31 @@ inline BOOST_MP_CXX14_CONSTEXPR void resize_for_carry(cpp_int_backend<MinBits1,
    if (result.size() < required)
       result.resize(required, required);
 }
-//
-// Minimum number of limbs required for Karatsuba to be worthwhile:
-//
-#ifdef BOOST_MP_KARATSUBA_CUTOFF
-const size_t karatsuba_cutoff = BOOST_MP_KARATSUBA_CUTOFF;
-#else
-const size_t karatsuba_cutoff = 40;
-#endif
+
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_toom3(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage);
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_toom4(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage);
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_toom32(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage);
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_unbalanced(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage);
 //
 // Core (recursive) Karatsuba multiplication, all the storage required is allocated upfront and 
 // passed down the stack in this routine.  Note that all the cpp_int_backend's must be the same type
@@ -102,17 +120,86 @@ inline void multiply_karatsuba(
    unsigned as = a.size();
    unsigned bs = b.size();
    //
+   // When squaring, a and b are distinct aliases of the same limbs, and we only
+   // need to form the sum of the high and low halves once:
+   //
+   bool square = (a.limbs() == b.limbs()) && (as == bs);
+   const cpp_int_tuning& tuning = get_cpp_int_tuning();
+   //
    // Termination condition: if either argument is smaller than karatsuba_cutoff
    // then schoolboy multiplication will be faster:
    //
-   if ((as < karatsuba_cutoff) || (bs < karatsuba_cutoff))
+   if (square ? (as < tuning.karatsuba_square_cutoff) : ((as < tuning.karatsuba_cutoff) || (bs < tuning.karatsuba_cutoff)))
    {
       eval_multiply(result, a, b);
       return;
    }
    //
+   // For very large arguments the NTT wins, and needs no further recursion,
+   // provided the product isn't too large for the transform:
+   //
+   if ((as >= tuning.ntt_cutoff) && (bs >= tuning.ntt_cutoff))
+   {
+      unsigned wrap;
+      unsigned log_n = ntt_transform_log(as, bs, wrap);
+      if (log_n <= ntt_max_log)
+      {
+         BOOST_MP_INSTRUMENT_COUNT(counter_multiply_ntt);
+         unsigned   scratch_size = ntt_storage_size(log_n, wrap);
+         limb_type* scratch      = storage.allocate(scratch_size);
+         multiply_ntt(result.limbs(), result.size(), a.limbs(), as, b.limbs(), bs, log_n, wrap, scratch);
+         storage.deallocate(scratch_size);
+         result.normalize();
+         return;
+      }
+   }
+   //
+   // When one argument is much longer than the other, the balanced splittings
+   // below waste most of their effort multiplying by zero, so slice the longer
+   // argument into pieces the size of the shorter one instead, or for moderately
+   // unbalanced arguments split them 3 ways by 2:
+   //
+   if ((as >= 2 * bs) || (bs >= 2 * as))
+   {
+      BOOST_MP_INSTRUMENT_COUNT(counter_multiply_unbalanced);
+      if (as >= bs)
+         multiply_unbalanced(result, a, b, storage);
+      else
+         multiply_unbalanced(result, b, a, storage);
+      return;
+   }
+   if (2 * as >= 3 * bs)
+   {
+      BOOST_MP_INSTRUMENT_COUNT(counter_multiply_toom32);
+      multiply_toom32(result, a, b, storage);
+      return;
+   }
+   if (2 * bs >= 3 * as)
+   {
+      BOOST_MP_INSTRUMENT_COUNT(counter_multiply_toom32);
+      multiply_toom32(result, b, a, storage);
+      return;
+   }
+   //
+   // For larger arguments hand over to the Toom-Cook routines, which
+   // recurse back into this one for each of their sub-products:
+   //
+   if ((as >= tuning.toom4_cutoff) && (bs >= tuning.toom4_cutoff))
+   {
+      BOOST_MP_INSTRUMENT_COUNT(counter_multiply_toom4);
+      multiply_toom4(result, a, b, storage);
+      return;
+   }
+   if ((as >= tuning.toom3_cutoff) && (bs >= tuning.toom3_cutoff))
+   {
+      BOOST_MP_INSTRUMENT_COUNT(counter_multiply_toom3);
+      multiply_toom3(result, a, b, storage);
+      return;
+   }
+   //
    // Partitioning size: split the larger of a and b into 2 halves
    //
+   BOOST_MP_INSTRUMENT_COUNT(counter_multiply_karatsuba);
    unsigned n  = (as > bs ? as : bs) / 2 + 1;
    //
    // Partition a and b into high and low parts.
@@ -183,8 +270,13 @@ inline void multiply_karatsuba(
    // Now calculate (a_h+a_l)*(b_h+b_l):
    //
    add_unsigned(t2, a_l, a_h);
-   add_unsigned(t3, b_l, b_h);
-   multiply_karatsuba(t1, t2, t3, storage); // t1 = (a_h+a_l)*(b_h+b_l)
+   if (square)
+      multiply_karatsuba(t1, t2, t2, storage); // t1 = (a_h+a_l)^2
+   else
+   {
+      add_unsigned(t3, b_l, b_h);
+      multiply_karatsuba(t1, t2, t3, storage); // t1 = (a_h+a_l)*(b_h+b_l)
+   }
    //
    // There is now a slight deviation from Karatsuba, we want to subtract
    // a_l*b_l + a_h*b_h from t1, but rather than use an addition and a subtraction
@@ -210,6 +302,528 @@ inline void multiply_karatsuba(
    result.normalize();
 }
 
+//
+// Helpers for the Toom-Cook routines below.  All of these operate on the temporaries
+// allocated from the shared storage, and so must never grow a value beyond its capacity.
+//
+// Returns a (normalized) alias to the i'th k-limb piece of x, or to zero if x has no such piece:
+//
+template <class CppInt>
+inline CppInt toom_split(const CppInt& x, unsigned i, unsigned k, const limb_type& zero)
+{
+   unsigned first = i * k;
+   if (first >= x.size())
+      return CppInt(&zero, 0, 1);
+   return CppInt(x.limbs() + first, 0, (std::min)(k, x.size() - first));
+}
+//
+// Exact division of the magnitude of x by a small odd constant d.  Since we know there is
+// no remainder we can multiply by the inverse of d modulo 2^limb_bits rather than divide,
+// and work from the least significant limb upwards (see Jebelean, "An algorithm for exact division").
+//
+template <class CppInt>
+inline void toom_divide_exact(CppInt& x, limb_type d)
+{
+   BOOST_ASSERT(d & 1u);
+   // Newton iteration for the inverse, each step doubles the number of correct bits,
+   // starting from 3 correct bits since d * d == 1 mod 8 for all odd d:
+   limb_type inv = d;
+   for (unsigned bits = 3; bits < CppInt::limb_bits; bits *= 2)
+      inv *= 2 - d * inv;
+
+   typename CppInt::limb_pointer p      = x.limbs();
+   limb_type                     borrow = 0;
+   for (unsigned i = 0; i < x.size(); ++i)
+   {
+      limb_type s = p[i] - borrow;
+      limb_type c = s > p[i] ? 1 : 0;
+      p[i]        = s * inv;
+      borrow      = c + static_cast<limb_type>((static_cast<double_limb_type>(p[i]) * d) >> CppInt::limb_bits);
+   }
+   BOOST_ASSERT(borrow == 0);
+   x.normalize();
+   x.sign(x.sign());
+}
+//
+// Exact right shift of the magnitude of x by less than one limb, used for the
+// divisions by powers of 2 during interpolation:
+//
+template <class CppInt>
+inline void toom_shift_right_exact(CppInt& x, unsigned bits)
+{
+   BOOST_ASSERT(bits && (bits < CppInt::limb_bits));
+   typename CppInt::limb_pointer p = x.limbs();
+   unsigned                      n = x.size();
+   BOOST_ASSERT((p[0] & ((static_cast<limb_type>(1u) << bits) - 1)) == 0);
+   for (unsigned i = 0; i + 1 < n; ++i)
+      p[i] = (p[i] >> bits) | (p[i + 1] << (CppInt::limb_bits - bits));
+   p[n - 1] >>= bits;
+   x.normalize();
+   x.sign(x.sign());
+}
+//
+// Multiplies two signed evaluation points p and q into r, the signs of p and q are not
+// preserved (the magnitudes are) as they're never needed again after this:
+//
+template <class CppInt>
+inline void toom_multiply_signed(CppInt& r, CppInt& p, CppInt& q, typename CppInt::scoped_shared_storage& storage)
+{
+   bool s = p.sign() != q.sign();
+   p.sign(false);
+   q.sign(false);
+   r.resize(p.size() + q.size(), p.size() + q.size());
+   multiply_karatsuba(r, p, q, storage);
+   r.sign(s);
+}
+//
+// Adds the (non-negative) coefficient c into result at the given limb offset, when the
+// operands are unbalanced the higher coefficients may be zero and lie beyond the end of
+// the result:
+//
+template <class CppInt>
+inline void toom_add_at(CppInt& result, unsigned offset, const CppInt& c)
+{
+   unsigned rs = result.size();
+   if (offset >= rs)
+   {
+      BOOST_ASSERT((c.size() == 1) && (c.limbs()[0] == 0));
+      return;
+   }
+   if (offset + 1 == rs)
+   {
+      // add_unsigned would need 2 limbs of storage here, but we know the sum fits in one:
+      BOOST_ASSERT(c.size() == 1);
+      result.limbs()[offset] += c.limbs()[0];
+      return;
+   }
+   CppInt t(result.limbs(), offset, rs - offset);
+   add_unsigned(t, t, c);
+}
+//
+// Toom-Cook 3-way multiplication: split a and b into 3 pieces of k limbs each, evaluate
+// the resulting polynomials at 0, 1, -1, -2 and infinity, multiply pointwise (recursing
+// back into multiply_karatsuba), and interpolate using the sequence from
+// Bodrato & Zanoni, "Integer and Polynomial Multiplication: Towards Optimal Toom-Cook Matrices".
+// As with Karatsuba, all temporaries come from the shared storage, and the result must
+// have at least a.size() + b.size() limbs.
+//
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_toom3(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage)
+{
+   typedef cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> cpp_int_type;
+
+   unsigned as = a.size();
+   unsigned bs = b.size();
+   unsigned rs = result.size();
+   unsigned k  = ((as > bs ? as : bs) + 2) / 3;
+   bool     square = (a.limbs() == b.limbs()) && (as == bs);
+   BOOST_ASSERT(rs >= as + bs);
+   //
+   // Partition a and b as a = a2 * 2^2k + a1 * 2^k + a0 etc, using aliases as before:
+   //
+   limb_type          zero = 0;
+   const cpp_int_type a0   = toom_split(a, 0, k, zero);
+   const cpp_int_type a1   = toom_split(a, 1, k, zero);
+   const cpp_int_type a2   = toom_split(a, 2, k, zero);
+   const cpp_int_type b0   = toom_split(b, 0, k, zero);
+   const cpp_int_type b1   = toom_split(b, 1, k, zero);
+   const cpp_int_type b2   = toom_split(b, 2, k, zero);
+   //
+   // Evaluated points need at most k+1 limbs, products of them at most 2k+2,
+   // the extra limbs are headroom for the intermediate sums:
+   //
+   cpp_int_type s_a(storage, k + 2);
+   cpp_int_type s_b(storage, k + 2);
+   cpp_int_type p(storage, k + 2);
+   cpp_int_type q(storage, k + 2);
+   cpp_int_type r1(storage, 2 * k + 6);
+   cpp_int_type rm1(storage, 2 * k + 6);
+   cpp_int_type rm2(storage, 2 * k + 6);
+   //
+   // The values at 0 and infinity are the low and high coefficients of the result,
+   // so multiply them directly into place:
+   //
+   bool         have_inf = (as > 2 * k) && (bs > 2 * k);
+   cpp_int_type r0(result.limbs(), 0, 2 * k);
+   cpp_int_type rinf(have_inf ? result.limbs() + 4 * k : &zero, 0, have_inf ? rs - 4 * k : 1);
+   multiply_karatsuba(r0, a0, b0, storage);
+   if (have_inf)
+      multiply_karatsuba(rinf, a2, b2, storage);
+   else
+      rinf.normalize();
+   for (unsigned i = r0.size(); i < (std::min)(4 * k, rs); ++i)
+      result.limbs()[i] = 0;
+   for (unsigned i = have_inf ? 4 * k + rinf.size() : 4 * k; i < rs; ++i)
+      result.limbs()[i] = 0;
+   //
+   // Values at 1 and -1.  When squaring, the evaluations of b are the same as
+   // those of a, and we skip them here and below:
+   //
+   add_unsigned(s_a, a0, a2);
+   add_unsigned(p, s_a, a1);
+   if (!square)
+   {
+      add_unsigned(s_b, b0, b2);
+      add_unsigned(q, s_b, b1);
+   }
+   toom_multiply_signed(r1, p, square ? p : q, storage);
+   eval_subtract(p, s_a, a1);
+   if (!square)
+      eval_subtract(q, s_b, b1);
+   //
+   // Value at -2 is 2 * (p(-1) + a2) - a0:
+   //
+   eval_add(s_a, p, a2);
+   eval_multiply(s_a, s_a, static_cast<limb_type>(2u));
+   eval_subtract(s_a, a0);
+   if (!square)
+   {
+      eval_add(s_b, q, b2);
+      eval_multiply(s_b, s_b, static_cast<limb_type>(2u));
+      eval_subtract(s_b, b0);
+   }
+   toom_multiply_signed(rm1, p, square ? p : q, storage);
+   toom_multiply_signed(rm2, s_a, square ? s_a : s_b, storage);
+   //
+   // Interpolation, afterwards r1, rm1 and rm2 hold the coefficients of 2^k, 2^2k and 2^3k:
+   //
+   eval_subtract(rm2, r1);
+   toom_divide_exact(rm2, 3u);       // (r(-2) - r(1)) / 3
+   eval_subtract(r1, rm1);
+   toom_shift_right_exact(r1, 1);    // (r(1) - r(-1)) / 2
+   eval_subtract(rm1, r0);           // r(-1) - r(0)
+   eval_subtract(rm2, rm1, rm2);
+   toom_shift_right_exact(rm2, 1);
+   eval_add(rm2, rinf);
+   eval_add(rm2, rinf);
+   eval_add(rm1, r1);
+   eval_subtract(rm1, rinf);
+   eval_subtract(r1, rm2);
+   BOOST_ASSERT(!r1.sign() && !rm1.sign() && !rm2.sign());
+   //
+   // Add the middle coefficients into the result at their offsets:
+   //
+   toom_add_at(result, k, r1);
+   toom_add_at(result, 2 * k, rm1);
+   toom_add_at(result, 3 * k, rm2);
+
+   storage.deallocate(s_a.capacity() + s_b.capacity() + p.capacity() + q.capacity() + r1.capacity() + rm1.capacity() + rm2.capacity());
+
+   result.normalize();
+}
+//
+// Toom-Cook 4-way multiplication: as above but with 4 pieces of k limbs each, evaluated at
+// 0, 1, -1, 2, -2, 1/2 (scaled by 8) and infinity, for 7 recursive products of size k
+// in place of Toom-3's 5 of size 4k/3.
+//
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_toom4(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage)
+{
+   typedef cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> cpp_int_type;
+
+   unsigned as = a.size();
+   unsigned bs = b.size();
+   unsigned rs = result.size();
+   unsigned k  = ((as > bs ? as : bs) + 3) / 4;
+   bool     square = (a.limbs() == b.limbs()) && (as == bs);
+   BOOST_ASSERT(rs >= as + bs);
+
+   limb_type          zero = 0;
+   const cpp_int_type a0   = toom_split(a, 0, k, zero);
+   const cpp_int_type a1   = toom_split(a, 1, k, zero);
+   const cpp_int_type a2   = toom_split(a, 2, k, zero);
+   const cpp_int_type a3   = toom_split(a, 3, k, zero);
+   const cpp_int_type b0   = toom_split(b, 0, k, zero);
+   const cpp_int_type b1   = toom_split(b, 1, k, zero);
+   const cpp_int_type b2   = toom_split(b, 2, k, zero);
+   const cpp_int_type b3   = toom_split(b, 3, k, zero);
+
+   cpp_int_type e_a(storage, k + 2);
+   cpp_int_type o_a(storage, k + 2);
+   cpp_int_type e_b(storage, k + 2);
+   cpp_int_type o_b(storage, k + 2);
+   cpp_int_type p(storage, k + 2);
+   cpp_int_type q(storage, k + 2);
+   cpp_int_type w1(storage, 2 * k + 6);
+   cpp_int_type wm1(storage, 2 * k + 6);
+   cpp_int_type w2(storage, 2 * k + 6);
+   cpp_int_type wm2(storage, 2 * k + 6);
+   cpp_int_type wh(storage, 2 * k + 6);
+   cpp_int_type t(storage, 2 * k + 6);
+   //
+   // Values at 0 and infinity go straight into the result:
+   //
+   bool         have_inf = (as > 3 * k) && (bs > 3 * k);
+   cpp_int_type w0(result.limbs(), 0, 2 * k);
+   cpp_int_type winf(have_inf ? result.limbs() + 6 * k : &zero, 0, have_inf ? rs - 6 * k : 1);
+   multiply_karatsuba(w0, a0, b0, storage);
+   if (have_inf)
+      multiply_karatsuba(winf, a3, b3, storage);
+   else
+      winf.normalize();
+   for (unsigned i = w0.size(); i < (std::min)(6 * k, rs); ++i)
+      result.limbs()[i] = 0;
+   for (unsigned i = have_inf ? 6 * k + winf.size() : 6 * k; i < rs; ++i)
+      result.limbs()[i] = 0;
+   //
+   // Values at 1 and -1 from the even and odd parts:
+   //
+   add_unsigned(e_a, a0, a2);
+   add_unsigned(o_a, a1, a3);
+   add_unsigned(p, e_a, o_a);
+   if (!square)
+   {
+      add_unsigned(e_b, b0, b2);
+      add_unsigned(o_b, b1, b3);
+      add_unsigned(q, e_b, o_b);
+   }
+   toom_multiply_signed(w1, p, square ? p : q, storage);
+   eval_subtract(p, e_a, o_a);
+   if (!square)
+      eval_subtract(q, e_b, o_b);
+   toom_multiply_signed(wm1, p, square ? p : q, storage);
+   //
+   // Values at 2 and -2, the even part is a0 + 4a2 and the odd part 2a1 + 8a3:
+   //
+   eval_multiply(e_a, a2, static_cast<limb_type>(4u));
+   add_unsigned(e_a, e_a, a0);
+   eval_multiply(o_a, a3, static_cast<limb_type>(4u));
+   add_unsigned(o_a, o_a, a1);
+   eval_multiply(o_a, o_a, static_cast<limb_type>(2u));
+   add_unsigned(p, e_a, o_a);
+   if (!square)
+   {
+      eval_multiply(e_b, b2, static_cast<limb_type>(4u));
+      add_unsigned(e_b, e_b, b0);
+      eval_multiply(o_b, b3, static_cast<limb_type>(4u));
+      add_unsigned(o_b, o_b, b1);
+      eval_multiply(o_b, o_b, static_cast<limb_type>(2u));
+      add_unsigned(q, e_b, o_b);
+   }
+   toom_multiply_signed(w2, p, square ? p : q, storage);
+   eval_subtract(p, e_a, o_a);
+   if (!square)
+      eval_subtract(q, e_b, o_b);
+   toom_multiply_signed(wm2, p, square ? p : q, storage);
+   //
+   // 8 times the value at 1/2 is 8a0 + 4a1 + 2a2 + a3, by Horner's rule:
+   //
+   eval_multiply(p, a0, static_cast<limb_type>(2u));
+   add_unsigned(p, p, a1);
+   eval_multiply(p, p, static_cast<limb_type>(2u));
+   add_unsigned(p, p, a2);
+   eval_multiply(p, p, static_cast<limb_type>(2u));
+   add_unsigned(p, p, a3);
+   if (!square)
+   {
+      eval_multiply(q, b0, static_cast<limb_type>(2u));
+      add_unsigned(q, q, b1);
+      eval_multiply(q, q, static_cast<limb_type>(2u));
+      add_unsigned(q, q, b2);
+      eval_multiply(q, q, static_cast<limb_type>(2u));
+      add_unsigned(q, q, b3);
+   }
+   toom_multiply_signed(wh, p, square ? p : q, storage);
+   //
+   // Interpolation, writing c0...c6 for the coefficients of the result, with c0 = w0
+   // and c6 = winf.  First split the values at +-1 and +-2 into odd and even parts:
+   //
+   eval_subtract(t, w1, wm1);
+   toom_shift_right_exact(t, 1);         // c1 + c3 + c5
+   eval_add(w1, wm1);
+   toom_shift_right_exact(w1, 1);        // c0 + c2 + c4 + c6
+   eval_subtract(wm1, w2, wm2);
+   toom_shift_right_exact(wm1, 2);       // c1 + 4c3 + 16c5
+   eval_add(w2, wm2);
+   toom_shift_right_exact(w2, 1);        // c0 + 4c2 + 16c4 + 64c6
+   //
+   // Even coefficients:
+   //
+   eval_subtract(w1, w0);
+   eval_subtract(w1, winf);              // c2 + c4
+   eval_subtract(w2, w0);
+   eval_multiply(wm2, winf, static_cast<limb_type>(64u));
+   eval_subtract(w2, wm2);
+   toom_shift_right_exact(w2, 2);        // c2 + 4c4
+   eval_subtract(w2, w1);
+   toom_divide_exact(w2, 3u);            // c4
+   eval_subtract(w1, w2);                // c2
+   //
+   // Remove the known coefficients from the value at 1/2:
+   //
+   eval_multiply(wm2, w0, static_cast<limb_type>(64u));
+   eval_subtract(wh, wm2);
+   eval_multiply(wm2, w1, static_cast<limb_type>(16u));
+   eval_subtract(wh, wm2);
+   eval_multiply(wm2, w2, static_cast<limb_type>(4u));
+   eval_subtract(wh, wm2);
+   eval_subtract(wh, winf);
+   toom_shift_right_exact(wh, 1);        // 16c1 + 4c3 + c5
+   //
+   // Odd coefficients:
+   //
+   eval_subtract(wm1, t);
+   toom_divide_exact(wm1, 3u);           // c3 + 5c5
+   eval_multiply(wm2, t, static_cast<limb_type>(16u));
+   eval_subtract(wm2, wh);
+   toom_divide_exact(wm2, 3u);           // 4c3 + 5c5
+   eval_subtract(wm2, wm1);
+   toom_divide_exact(wm2, 3u);           // c3
+   eval_subtract(wm1, wm2);
+   toom_divide_exact(wm1, 5u);           // c5
+   eval_subtract(t, wm2);
+   eval_subtract(t, wm1);                // c1
+   BOOST_ASSERT(!t.sign() && !w1.sign() && !wm2.sign() && !w2.sign() && !wm1.sign());
+   //
+   // And add c1...c5 into the result:
+   //
+   toom_add_at(result, k, t);
+   toom_add_at(result, 2 * k, w1);
+   toom_add_at(result, 3 * k, wm2);
+   toom_add_at(result, 4 * k, w2);
+   toom_add_at(result, 5 * k, wm1);
+
+   storage.deallocate(e_a.capacity() + o_a.capacity() + e_b.capacity() + o_b.capacity() + p.capacity() + q.capacity() 
+      + w1.capacity() + wm1.capacity() + w2.capacity() + wm2.capacity() + wh.capacity() + t.capacity());
+
+   result.normalize();
+}
+
+//
+// Toom-Cook 3x2 way multiplication (sometimes called Toom-2.5) for arguments whose sizes
+// are roughly in the ratio 3:2: a is split into 3 pieces of k limbs and b into 2, and
+// the product polynomial evaluated at 0, 1, -1 and infinity, for 4 recursive products
+// of size k in place of the 3 of size 3k/2 that Karatsuba would use.  Requires
+// a.size() >= b.size(), and as usual the result must have at least a.size() + b.size() limbs.
+//
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_toom32(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage)
+{
+   typedef cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> cpp_int_type;
+
+   unsigned as = a.size();
+   unsigned bs = b.size();
+   unsigned rs = result.size();
+   unsigned k  = (std::max)((as + 2) / 3, (bs + 1) / 2);
+   BOOST_ASSERT(as >= bs);
+   BOOST_ASSERT(rs >= as + bs);
+   //
+   // Partition a = a2 * 2^2k + a1 * 2^k + a0 and b = b1 * 2^k + b0:
+   //
+   limb_type          zero = 0;
+   const cpp_int_type a0   = toom_split(a, 0, k, zero);
+   const cpp_int_type a1   = toom_split(a, 1, k, zero);
+   const cpp_int_type a2   = toom_split(a, 2, k, zero);
+   const cpp_int_type b0   = toom_split(b, 0, k, zero);
+   const cpp_int_type b1   = toom_split(b, 1, k, zero);
+
+   cpp_int_type s_a(storage, k + 2);
+   cpp_int_type p(storage, k + 2);
+   cpp_int_type q(storage, k + 2);
+   cpp_int_type r1(storage, 2 * k + 6);
+   cpp_int_type rm1(storage, 2 * k + 6);
+   //
+   // The values at 0 and infinity are the coefficients of 1 and 2^3k, and don't
+   // overlap, so multiply them directly into place:
+   //
+   bool         have_inf = (as > 2 * k) && (bs > k);
+   cpp_int_type r0(result.limbs(), 0, 2 * k);
+   cpp_int_type rinf(have_inf ? result.limbs() + 3 * k : &zero, 0, have_inf ? rs - 3 * k : 1);
+   multiply_karatsuba(r0, a0, b0, storage);
+   if (have_inf)
+      multiply_karatsuba(rinf, a2, b1, storage);
+   else
+      rinf.normalize();
+   for (unsigned i = r0.size(); i < (std::min)(3 * k, rs); ++i)
+      result.limbs()[i] = 0;
+   for (unsigned i = have_inf ? 3 * k + rinf.size() : 3 * k; i < rs; ++i)
+      result.limbs()[i] = 0;
+   //
+   // Values at 1 and -1:
+   //
+   add_unsigned(s_a, a0, a2);
+   add_unsigned(p, s_a, a1);
+   add_unsigned(q, b0, b1);
+   toom_multiply_signed(r1, p, q, storage);
+   eval_subtract(p, s_a, a1);
+   eval_subtract(q, b0, b1);
+   toom_multiply_signed(rm1, p, q, storage);
+   //
+   // Interpolation: r(1) - r(-1) is twice the sum of the odd coefficients, and
+   // r(1) + r(-1) twice the sum of the even ones:
+   //
+   eval_subtract(r1, rm1);
+   toom_shift_right_exact(r1, 1);    // c1 + c3
+   eval_add(rm1, r1);                // c0 + c2
+   eval_subtract(rm1, r0);
+   eval_subtract(r1, rinf);
+   BOOST_ASSERT(!r1.sign() && !rm1.sign());
+
+   toom_add_at(result, k, r1);
+   toom_add_at(result, 2 * k, rm1);
+
+   storage.deallocate(s_a.capacity() + p.capacity() + q.capacity() + r1.capacity() + rm1.capacity());
+
+   result.normalize();
+}
+//
+// Multiplication of a long argument a by a much shorter b: slice a into pieces of b.size() limbs
+// and multiply each by b as a balanced product.  The products of the even numbered slices
+// don't overlap, so are formed directly in the result, while the odd ones go via a temporary
+// and are added in afterwards.  Requires a.size() >= b.size(), and the result must have
+// at least a.size() + b.size() limbs.
+//
+template <unsigned MinBits, unsigned MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_unbalanced(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage)
+{
+   typedef cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> cpp_int_type;
+
+   unsigned as = a.size();
+   unsigned bs = b.size();
+   unsigned rs = result.size();
+   BOOST_ASSERT(as >= bs);
+   BOOST_ASSERT(rs >= as + bs);
+
+   std::fill(result.limbs(), result.limbs() + rs, static_cast<limb_type>(0u));
+   for (unsigned offset = 0; offset < as; offset += 2 * bs)
+   {
+      unsigned           len = (std::min)(bs, as - offset);
+      const cpp_int_type a_i(a.limbs(), offset, len);
+      cpp_int_type       r_i(result.limbs(), offset, len + bs);
+      multiply_karatsuba(r_i, a_i, b, storage);
+   }
+   if (as > bs)
+   {
+      cpp_int_type t(storage, 2 * bs);
+      for (unsigned offset = bs; offset < as; offset += 2 * bs)
+      {
+         unsigned           len = (std::min)(bs, as - offset);
+         const cpp_int_type a_i(a.limbs(), offset, len);
+         t.resize(len + bs, len + bs);
+         multiply_karatsuba(t, a_i, b, storage);
+         toom_add_at(result, offset, t);
+      }
+      storage.deallocate(t.capacity());
+   }
+   result.normalize();
+}
+
 inline unsigned karatsuba_storage_size(unsigned s)
 {
    // 
@@ -222,7 +836,68 @@ inline unsigned karatsuba_storage_size(unsigned s)
    // which over-estimates how much we need.  We could compute an exact
    // value, but it would be rather time consuming.
    //
-   return 5 * s;
+   // The Toom-Cook routines allocate 10k+26 (Toom-3) or 18k+48 (Toom-4) limbs
+   // for a k-limb split, and then recurse on at most k+1 limbs.  The unbalanced
+   // routines need rather less than that for an argument of the same size:
+   //
+   // The NTT may be used for this product or for any sub-product, whichever of the
+   // tiers below multiply_karatsuba dispatches to, and needs at most 6L limbs for a
+   // transform of length L.  We allow for the largest transform without any wrapped
+   // coefficients since unbalanced sub-products may not wrap:
+   //
+   const cpp_int_tuning& tuning = get_cpp_int_tuning();
+   unsigned              ntt    = 0;
+   if (s >= tuning.ntt_cutoff)
+   {
+      unsigned wrap;
+      unsigned log_n = ntt_transform_log(s, s, wrap);
+      if (wrap)
+         ++log_n;
+      ntt = 6u << (std::min)(log_n, ntt_max_log);
+   }
+   unsigned tier;
+   if (s >= tuning.toom4_cutoff)
+   {
+      unsigned k = (s + 3) / 4;
+      tier       = 18 * k + 48 + karatsuba_storage_size(k + 2);
+   }
+   else if (s >= tuning.toom3_cutoff)
+   {
+      unsigned k = (s + 2) / 3;
+      tier       = 10 * k + 26 + karatsuba_storage_size(k + 2);
+   }
+   else
+      tier = 5 * s;
+   return ntt + tier;
+}
+//
+// Storage for an as by bs limb product: the bound above assumes a balanced product of the
+// larger size, so here we follow the first step of multiply_karatsuba's dispatch and only
+// fall back on the bound above for the sub-products.  A long argument times a short one is
+// sliced into products the size of the shorter, plus the accumulator for the odd slices,
+// and moderately unbalanced arguments are split 3 ways by 2 into sub-products of k + 2
+// limbs at most.  The NTT is only reachable when both arguments are over the cutoff:
+//
+inline unsigned karatsuba_storage_size(unsigned as, unsigned bs)
+{
+   if (as < bs)
+      std::swap(as, bs);
+   const cpp_int_tuning& tuning = get_cpp_int_tuning();
+   if (bs >= tuning.ntt_cutoff)
+   {
+      unsigned wrap;
+      unsigned log_n = ntt_transform_log(as, bs, wrap);
+      if (log_n <= ntt_max_log)
+         return ntt_storage_size(log_n, wrap);
+   }
+   if (as >= 2 * bs)
+      return 2 * bs + karatsuba_storage_size(bs);
+   if (2 * as >= 3 * bs)
+   {
+      unsigned k = (std::max)((as + 2) / 3, (bs + 1) / 2);
+      return 7 * k + 18 + karatsuba_storage_size(k + 2);
+   }
+   return karatsuba_storage_size(as);
 }
 //
 // There are 2 entry point routines for Karatsuba multiplication:
@@ -239,10 +914,7 @@ setup_karatsuba(
    const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& a,
    const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& b)
 {
-   unsigned as = a.size();
-   unsigned bs = b.size();
-   unsigned s = as > bs ? as : bs;
-   unsigned storage_size = karatsuba_storage_size(s);
+   unsigned storage_size = karatsuba_storage_size(a.size(), b.size());
    if (storage_size < 300)
    {
       //
@@ -280,9 +952,8 @@ setup_karatsuba(
    variable_precision_type a_t(a.limbs(), 0, a.size()), b_t(b.limbs(), 0, b.size());
    unsigned as = a.size();
    unsigned bs = b.size();
-   unsigned s = as > bs ? as : bs;
    unsigned sz = as + bs;
-   unsigned storage_size = karatsuba_storage_size(s);
+   unsigned storage_size = karatsuba_storage_size(as, bs);
 
    if (sz * sizeof(limb_type) * CHAR_BIT <= MaxBits1)
    {
@@ -358,6 +1029,68 @@ eval_multiply_comba(
          *pr = static_cast<limb_type>(carry);
    }
 }
+//
+// Runtime form of the Karatsuba cutoff test for variable precision types:
+//
+inline bool use_karatsuba(unsigned as, unsigned bs, bool square) BOOST_NOEXCEPT
+{
+   const cpp_int_tuning& tuning = get_cpp_int_tuning();
+   return square ? as >= tuning.karatsuba_square_cutoff : (as >= tuning.karatsuba_cutoff && bs >= tuning.karatsuba_cutoff);
+}
+//
+// Schoolbook squaring: each cross product a[i] * a[j] with i != j occurs twice in the
+// square, so we sum the upper triangle i < j just once, then double it and add in the
+// diagonal terms a[i]^2, for roughly half the limb multiplications of the general case.
+// result must have space for 2 * a.size() limbs.
+//
+template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, unsigned MinBits2, unsigned MaxBits2, cpp_integer_type SignType2, cpp_int_check_type Checked2, class Allocator2>
+inline BOOST_MP_CXX14_CONSTEXPR void
+square_schoolbook(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>& a) BOOST_NOEXCEPT
+{
+   const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   unsigned       as        = a.size();
+   BOOST_ASSERT(result.size() >= 2 * as);
+
+   typename cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_pointer       pr = result.limbs();
+   typename cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>::const_limb_pointer pa = a.limbs();
+
+   for (unsigned i = 0; i < result.size(); ++i)
+      pr[i] = 0;
+   for (unsigned i = 0; i + 1 < as; ++i)
+   {
+      double_limb_type carry = 0;
+      for (unsigned j = i + 1; j < as; ++j)
+      {
+         carry += static_cast<double_limb_type>(pa[i]) * static_cast<double_limb_type>(pa[j]) + pr[i + j];
+         pr[i + j] = static_cast<limb_type>(carry);
+         carry >>= limb_bits;
+      }
+      pr[i + as] = static_cast<limb_type>(carry);
+   }
+   //
+   // Double the cross products by shifting left as we go, and add the diagonal:
+   //
+   limb_type        shifted_out = 0;
+   double_limb_type carry       = 0;
+   for (unsigned i = 0; i < as; ++i)
+   {
+      double_limb_type sq = static_cast<double_limb_type>(pa[i]) * static_cast<double_limb_type>(pa[i]);
+      limb_type        lo = pr[2 * i];
+      limb_type        hi = pr[2 * i + 1];
+      carry += static_cast<double_limb_type>(static_cast<limb_type>((lo << 1) | shifted_out)) + static_cast<limb_type>(sq);
+      pr[2 * i] = static_cast<limb_type>(carry);
+      carry >>= limb_bits;
+      carry += static_cast<double_limb_type>(static_cast<limb_type>((hi << 1) | (lo >> (limb_bits - 1)))) + static_cast<limb_type>(sq >> limb_bits);
+      pr[2 * i + 1] = static_cast<limb_type>(carry);
+      carry >>= limb_bits;
+      shifted_out = hi >> (limb_bits - 1);
+   }
+   BOOST_ASSERT(!carry && !shifted_out);
+   result.normalize();
+}
+
 template <unsigned MinBits1, unsigned MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, unsigned MinBits2, unsigned MaxBits2, cpp_integer_type SignType2, cpp_int_check_type Checked2, class Allocator2, unsigned MinBits3, unsigned MaxBits3, cpp_integer_type SignType3, cpp_int_check_type Checked3, class Allocator3>
 inline BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits3, MaxBits3, SignType3, Checked3, Allocator3> >::value>::type
 eval_multiply(
@@ -383,6 +1116,7 @@ eval_multiply(
       bool s = b.sign() != a.sign();
       if (bs == 1)
       {
+         BOOST_MP_INSTRUMENT_COUNT_RUNTIME(counter_multiply_limb, bs);
          result = static_cast<double_limb_type>(*pa) * static_cast<double_limb_type>(*pb);
       }
       else
@@ -402,10 +1136,19 @@ eval_multiply(
       return;
    }
 
+   if (multiply_fixed_width(result, a, b))
+   {
+      BOOST_MP_INSTRUMENT_COUNT_RUNTIME(counter_multiply_fixed_width, as);
+      return;
+   }
+
    if ((void*)&result == (void*)&a)
    {
       cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> t(a);
-      eval_multiply(result, t, b);
+      if ((void*)&a == (void*)&b)
+         eval_multiply(result, t, t); // keep squares recognisable as such
+      else
+         eval_multiply(result, t, b);
       return;
    }
    if ((void*)&result == (void*)&b)
@@ -423,12 +1166,19 @@ eval_multiply(
    constexpr const double_limb_type double_limb_max = ~static_cast<double_limb_type>(0u);
 #endif
    result.resize(as + bs, as + bs - 1);
+   bool square = (a.limbs() == b.limbs()) && (as == bs);
+   //
+   // Fixed precision types use the compile-time cutoffs: they may be constexpr, and
+   // the small ones are declared non-throwing on the basis of those values above:
+   //
+   const bool fixed = is_fixed_precision<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value;
 #ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
-   if (!BOOST_MP_IS_CONST_EVALUATED(as) && (as >= karatsuba_cutoff && bs >= karatsuba_cutoff))
+   if (!BOOST_MP_IS_CONST_EVALUATED(as) && (fixed ? (square ? as >= karatsuba_square_cutoff : (as >= karatsuba_cutoff && bs >= karatsuba_cutoff)) : use_karatsuba(as, bs, square)))
 #else
-   if (as >= karatsuba_cutoff && bs >= karatsuba_cutoff)
+   if (fixed ? (square ? as >= karatsuba_square_cutoff : (as >= karatsuba_cutoff && bs >= karatsuba_cutoff)) : use_karatsuba(as, bs, square))
 #endif
    {
+      BOOST_MP_INSTRUMENT_COUNT(counter_multiply_recursive);
       setup_karatsuba(result, a, b);
       //
       // Set the sign of the result:
@@ -436,6 +1186,17 @@ eval_multiply(
       result.sign(a.sign() != b.sign());
       return;
    }
+   if (square && (result.size() >= 2 * as))
+   {
+      //
+      // Squaring, and there's room for all the bits of the result:
+      //
+      BOOST_MP_INSTRUMENT_COUNT_RUNTIME(counter_square_schoolbook, as);
+      square_schoolbook(result, a);
+      result.sign(a.sign() != b.sign());
+      return;
+   }
+   BOOST_MP_INSTRUMENT_COUNT_RUNTIME(counter_multiply_schoolbook, as);
    typename cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_pointer pr = result.limbs();
    BOOST_STATIC_ASSERT(double_limb_max - 2 * limb_max >= limb_max * limb_max);
 
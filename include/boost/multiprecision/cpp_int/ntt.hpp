@@ -0,0 +1,449 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Number theoretic transform (NTT) multiplication for cpp_int_backend.
+//
+// Each limb of the two arguments is treated as one coefficient of a polynomial, the
+// product polynomial is computed by a cyclic convolution modulo 3 primes of the form
+// c * 2^k + 1, and the coefficients are then recovered exactly via the Chinese Remainder
+// Theorem and carried into the result.  The 3 primes have a product large enough to hold
+// any coefficient of the product, so there is no rounding error to worry about.
+//
+// All the routines here work on raw limb arrays, the cpp_int_backend plumbing lives
+// in multiply.hpp, and the user-facing ntt_multiplier at the end of this file.
+//
+
+#ifndef BOOST_MP_CPP_INT_NTT_HPP
+#define BOOST_MP_CPP_INT_NTT_HPP
+
+#include <vector>
+
+namespace boost { namespace multiprecision { namespace backends {
+
+#if defined(BOOST_HAS_INT128)
+//
+// Primes 29 * 2^57 + 1, 27 * 2^56 + 1 and 69 * 2^55 + 1, all less than 2^62 as required
+// by the Montgomery arithmetic below, along with a primitive root for each.
+// Their product exceeds 2^183 so any coefficient of an n-limb product is representable
+// for n < 2^55, which is also the largest transform they support:
+//
+static const limb_type ntt_primes[3]     = {0x3a00000000000001uLL, 0x1b00000000000001uLL, 0x2280000000000001uLL};
+static const limb_type ntt_generators[3] = {3, 5, 5};
+static const unsigned  ntt_max_log       = 55;
+#else
+//
+// Primes 7 * 2^26 + 1, 5 * 2^25 + 1 and 45 * 2^24 + 1, all less than 2^30.  Their product
+// is just over 2^85, so the coefficients of the product fit as long as the smaller argument
+// has at most 2^21 limbs, which limits the transform to 2^22 points:
+//
+static const limb_type ntt_primes[3]     = {0x1c000001u, 0xa000001u, 0x2d000001u};
+static const limb_type ntt_generators[3] = {3, 3, 11};
+static const unsigned  ntt_max_log       = 22;
+#endif
+
+//
+// Montgomery arithmetic modulo one of the primes above, with R = 2^limb_bits.  Values in
+// Montgomery form are x * R mod p, and are always fully reduced into [0, p).
+//
+struct ntt_field
+{
+   static const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+
+   limb_type p;     // the prime
+   limb_type p_inv; // -1/p mod R
+   limb_type one;   // R mod p, ie 1 in Montgomery form
+   limb_type r2;    // R^2 mod p, used to convert into Montgomery form
+
+   explicit ntt_field(limb_type prime) : p(prime)
+   {
+      // Newton iteration for 1/p mod R, as in toom_divide_exact:
+      limb_type inv = p;
+      for (unsigned bits = 3; bits < limb_bits; bits *= 2)
+         inv *= 2 - p * inv;
+      p_inv = 0 - inv;
+      one   = static_cast<limb_type>(0 - p) % p;
+      r2    = static_cast<limb_type>((static_cast<double_limb_type>(one) * one) % p);
+   }
+   //
+   // Returns a * b / R mod p, valid for any a < R provided b < p, which means that
+   // multiplying a raw value by something in Montgomery form yields a normal residue:
+   //
+   limb_type mul(limb_type a, limb_type b) const
+   {
+      double_limb_type t = static_cast<double_limb_type>(a) * b;
+      limb_type        m = static_cast<limb_type>(t) * p_inv;
+      limb_type        r = static_cast<limb_type>((t + static_cast<double_limb_type>(m) * p) >> limb_bits);
+      return r >= p ? r - p : r;
+   }
+   limb_type add(limb_type a, limb_type b) const
+   {
+      limb_type r = a + b;
+      return r >= p ? r - p : r;
+   }
+   limb_type sub(limb_type a, limb_type b) const
+   {
+      return a >= b ? a - b : a + p - b;
+   }
+   limb_type to_montgomery(limb_type a) const { return mul(a, r2); }
+   //
+   // Raises x (in Montgomery form) to the power e:
+   //
+   limb_type pow(limb_type x, limb_type e) const
+   {
+      limb_type r = one;
+      while (e)
+      {
+         if (e & 1u)
+            r = mul(r, x);
+         x = mul(x, x);
+         e >>= 1;
+      }
+      return r;
+   }
+   limb_type inverse(limb_type x) const { return pow(x, p - 2); }
+};
+
+//
+// Chooses the transform size 2^log_n for a product of as and bs limbs, which has
+// as + bs - 1 coefficients.  A cyclic convolution of length L folds coefficient L + t
+// back onto coefficient t, so when the product is only just over a power of 2 we
+// use a transform of half the size instead, and compute the few "wrapped" top
+// coefficients directly (at a cost of wrap^2 / 2 multiplications) so that they can
+// be separated out again afterwards.  Returns the number of wrapped coefficients in wrap.
+//
+inline unsigned ntt_transform_log(unsigned as, unsigned bs, unsigned& wrap)
+{
+   unsigned n     = as + bs - 1;
+   unsigned log_n = 1;
+   while ((static_cast<double_limb_type>(1u) << log_n) < n)
+      ++log_n;
+   unsigned half = 1u << (log_n - 1);
+   wrap          = 0;
+   if ((n > half) && (static_cast<double_limb_type>(n - half) * (n - half) <= half) && (n - half < (std::min)(as, bs)))
+   {
+      wrap = n - half;
+      --log_n;
+   }
+   return log_n;
+}
+//
+// Scratch space required by multiply_ntt: a transform of each argument for each prime,
+// a table of roots of unity, and 4 buffers for the wrapped coefficients.  Since wrap is
+// at most sqrt(L), 6L limbs is always enough for any product using a transform of length L.
+//
+inline unsigned ntt_storage_size(unsigned log_n, unsigned wrap)
+{
+   return (5u << log_n) + 4 * wrap;
+}
+//
+// Fills roots[1, L) with the roots of unity needed by each level of the transform,
+// in Montgomery form: roots[len + j] is w^j for w a primitive 2len'th root of unity.
+// Storing each level contiguously keeps the butterflies' memory access sequential:
+//
+inline void ntt_roots(limb_type* roots, unsigned log_n, const ntt_field& f, limb_type generator)
+{
+   unsigned  half = 1u << (log_n - 1);
+   limb_type w    = f.pow(f.to_montgomery(generator), (f.p - 1) >> log_n);
+   roots[half]    = f.one;
+   for (unsigned j = 1; j < half; ++j)
+      roots[half + j] = f.mul(roots[half + j - 1], w);
+   for (unsigned len = half / 2; len; len /= 2)
+      for (unsigned j = 0; j < len; ++j)
+         roots[len + j] = roots[2 * len + 2 * j];
+}
+//
+// Forward transform (decimation in frequency), the input is in natural order and
+// the output in bit-reversed order, which is fine since all we do with it is
+// pointwise multiplication followed by ntt_inverse, which takes bit-reversed input:
+//
+inline void ntt_forward(limb_type* x, unsigned log_n, const limb_type* roots, const ntt_field& f)
+{
+   unsigned n = 1u << log_n;
+   for (unsigned len = n / 2; len; len /= 2)
+   {
+      const limb_type* w = roots + len;
+      for (unsigned i = 0; i < n; i += 2 * len)
+      {
+         limb_type u = x[i];
+         limb_type v = x[i + len];
+         x[i]        = f.add(u, v);
+         x[i + len]  = f.sub(u, v);
+         for (unsigned j = 1; j < len; ++j)
+         {
+            u              = x[i + j];
+            v              = x[i + j + len];
+            x[i + j]       = f.add(u, v);
+            x[i + j + len] = f.mul(f.sub(u, v), w[j]);
+         }
+      }
+   }
+}
+//
+// Inverse transform (decimation in time), without the final division by L.
+// We only have the positive powers of each root w in the table, so use w^-j = -w^(len - j):
+//
+inline void ntt_inverse(limb_type* x, unsigned log_n, const limb_type* roots, const ntt_field& f)
+{
+   unsigned n = 1u << log_n;
+   for (unsigned len = 1; len < n; len *= 2)
+   {
+      const limb_type* w = roots + 2 * len;
+      for (unsigned i = 0; i < n; i += 2 * len)
+      {
+         limb_type u = x[i];
+         limb_type v = x[i + len];
+         x[i]        = f.add(u, v);
+         x[i + len]  = f.sub(u, v);
+         for (unsigned j = 1; j < len; ++j)
+         {
+            u              = x[i + j];
+            v              = f.mul(x[i + j + len], w[-static_cast<int>(j)]);
+            x[i + j]       = f.sub(u, v);
+            x[i + j + len] = f.add(u, v);
+         }
+      }
+   }
+}
+//
+// Loads the s limbs of a into the L-point buffer x, converting to Montgomery form
+// and zero padding, then transforms:
+//
+inline void ntt_load_and_transform(limb_type* x, const limb_type* a, unsigned s, unsigned log_n, const limb_type* roots, const ntt_field& f)
+{
+   unsigned n = 1u << log_n;
+   unsigned i = 0;
+   BOOST_ASSERT(s <= n);
+   for (; i < s; ++i)
+      x[i] = f.to_montgomery(a[i]);
+   for (; i < n; ++i)
+      x[i] = 0;
+   ntt_forward(x, log_n, roots, f);
+}
+//
+// Computes the forward transforms of the s limbs of a, for each of the 3 primes,
+// into x[0, 3L), ready for passing to multiply_ntt as a precomputed transform.
+// roots must have space for L limbs.
+//
+inline void ntt_transform_operand(limb_type* x, const limb_type* a, unsigned s, unsigned log_n, limb_type* roots)
+{
+   for (unsigned k = 0; k < 3; ++k)
+   {
+      ntt_field f(ntt_primes[k]);
+      ntt_roots(roots, log_n, f, ntt_generators[k]);
+      ntt_load_and_transform(x + (k << log_n), a, s, log_n, roots, f);
+   }
+}
+//
+// Multiplies the as limbs of a by the bs limbs of b into the rs >= as + bs limbs of r, using
+// a transform of length 2^log_n with wrap wrapped coefficients as chosen by ntt_transform_log.
+// If b_transform is non-null it contains the output of ntt_transform_operand for b and
+// the same log_n.  scratch must have space for ntt_storage_size(log_n, wrap) limbs and must
+// not overlap any of the arguments.
+//
+inline void multiply_ntt(limb_type* r, unsigned rs, const limb_type* a, unsigned as, const limb_type* b, unsigned bs,
+                         unsigned log_n, unsigned wrap, limb_type* scratch, const limb_type* b_transform = 0)
+{
+   BOOST_ASSERT(log_n <= ntt_max_log);
+   BOOST_ASSERT(rs >= as + bs);
+   BOOST_ASSERT(as + bs - 1 == (1u << log_n) + wrap || (!wrap && (as + bs - 1 <= (1u << log_n))));
+
+   const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   const unsigned n         = 1u << log_n;
+   const bool     square    = (a == b) && (as == bs);
+   //
+   // Scratch layout: the 3 residue vectors, then the transform of b, the roots, and the wrapped coefficients:
+   //
+   limb_type* residues   = scratch;
+   limb_type* b_work     = scratch + 3 * n;
+   limb_type* roots      = b_work + n;
+   limb_type* top        = roots + n;
+   limb_type* b_top_mont = top + 3 * wrap;
+
+   for (unsigned k = 0; k < 3; ++k)
+   {
+      ntt_field  f(ntt_primes[k]);
+      limb_type* x = residues + k * n;
+      ntt_roots(roots, log_n, f, ntt_generators[k]);
+      ntt_load_and_transform(x, a, as, log_n, roots, f);
+      if (b_transform)
+      {
+         const limb_type* y = b_transform + k * n;
+         for (unsigned i = 0; i < n; ++i)
+            x[i] = f.mul(x[i], y[i]);
+      }
+      else if (square)
+      {
+         for (unsigned i = 0; i < n; ++i)
+            x[i] = f.mul(x[i], x[i]);
+      }
+      else
+      {
+         ntt_load_and_transform(b_work, b, bs, log_n, roots, f);
+         for (unsigned i = 0; i < n; ++i)
+            x[i] = f.mul(x[i], b_work[i]);
+      }
+      ntt_inverse(x, log_n, roots, f);
+      //
+      // Divide by L and convert out of Montgomery form in one step, the inverse of L is
+      // p - (p - 1) / L since L divides p - 1:
+      //
+      limb_type l_inv = f.p - ((f.p - 1) >> log_n);
+      for (unsigned i = 0; i < n; ++i)
+         x[i] = f.mul(x[i], l_inv);
+      //
+      // Compute the wrapped coefficients L + t directly, these only involve the top
+      // wrap limbs of each argument, and subtract them back out of coefficient t:
+      //
+      if (wrap)
+      {
+         limb_type* t_k = top + k * wrap;
+         for (unsigned i = 0; i < wrap; ++i)
+            b_top_mont[i] = f.to_montgomery(b[bs - wrap + i]);
+         for (unsigned t = 0; t < wrap; ++t)
+         {
+            // Coefficient L + t is the sum of a[i] * b[L + t - i] over as - wrap + t <= i < as:
+            limb_type sum = 0;
+            for (unsigned i = as - wrap + t; i < as; ++i)
+               sum = f.add(sum, f.mul(a[i], b_top_mont[n + t - i - (bs - wrap)]));
+            t_k[t] = sum;
+            x[t]   = f.sub(x[t], sum);
+         }
+      }
+   }
+   //
+   // Chinese Remainder reconstruction by Garner's algorithm: each coefficient is
+   // r0 + p0 * t1 + p0 * p1 * t2 with t1 < p1 and t2 < p2.  Constants that we multiply
+   // by are kept in Montgomery form so that each product yields a normal residue:
+   //
+   ntt_field f0(ntt_primes[0]), f1(ntt_primes[1]), f2(ntt_primes[2]);
+   limb_type p0_1    = f1.to_montgomery(f0.p);
+   limb_type inv_p0  = f1.inverse(p0_1);
+   limb_type p0_2    = f2.to_montgomery(f0.p);
+   limb_type p01_2   = f2.mul(p0_2, f2.to_montgomery(f1.p));
+   limb_type inv_p01 = f2.inverse(p01_2);
+
+   double_limb_type p01    = static_cast<double_limb_type>(f0.p) * f1.p;
+   limb_type        p01_lo = static_cast<limb_type>(p01);
+   limb_type        p01_hi = static_cast<limb_type>(p01 >> limb_bits);
+
+   limb_type carry[3] = {0, 0, 0};
+   unsigned  coefficients = n + wrap;
+   unsigned  i            = 0;
+   for (; i < coefficients; ++i)
+   {
+      limb_type r_0 = i < n ? residues[i] : top[i - n];
+      limb_type r_1 = i < n ? residues[n + i] : top[wrap + i - n];
+      limb_type r_2 = i < n ? residues[2 * n + i] : top[2 * wrap + i - n];
+
+      limb_type t1 = f1.mul(f1.sub(r_1, f1.mul(r_0, f1.one)), inv_p0);
+      limb_type u  = f2.add(f2.mul(r_0, f2.one), f2.mul(t1, p0_2));
+      limb_type t2 = f2.mul(f2.sub(r_2, u), inv_p01);
+      //
+      // Value is low + p0 * p1 * t2, where low = r0 + p0 * t1 fits in 2 limbs:
+      //
+      double_limb_type low = static_cast<double_limb_type>(f0.p) * t1 + r_0;
+      double_limb_type v   = static_cast<double_limb_type>(p01_lo) * t2;
+      double_limb_type w   = static_cast<double_limb_type>(p01_hi) * t2 + (v >> limb_bits);
+      //
+      // Add to the 3-limb carry and output the low limb:
+      //
+      double_limb_type s = static_cast<double_limb_type>(carry[0]) + static_cast<limb_type>(v) + static_cast<limb_type>(low);
+      if (i < rs)
+         r[i] = static_cast<limb_type>(s);
+      s >>= limb_bits;
+      s += static_cast<double_limb_type>(carry[1]) + static_cast<limb_type>(w) + static_cast<limb_type>(low >> limb_bits);
+      carry[0] = static_cast<limb_type>(s);
+      s >>= limb_bits;
+      s += static_cast<double_limb_type>(carry[2]) + static_cast<limb_type>(w >> limb_bits);
+      carry[1] = static_cast<limb_type>(s);
+      carry[2] = static_cast<limb_type>(s >> limb_bits);
+   }
+   for (unsigned j = 0; j < 3; ++j, ++i)
+   {
+      if (i < rs)
+         r[i] = carry[j];
+      else
+         BOOST_ASSERT(carry[j] == 0);
+   }
+   for (; i < rs; ++i)
+      r[i] = 0;
+}
+
+}}} // namespace boost::multiprecision::backends
+
+namespace boost { namespace multiprecision {
+
+//
+// Multiplies many different values by one fixed value, reusing the forward transforms
+// of the fixed value whenever the product is large enough to use the NTT.  This is
+// only supported for arbitrary precision cpp_int types: for everything else there is no
+// transform to reuse.
+//
+template <class Number>
+class ntt_multiplier;
+
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+class ntt_multiplier<number<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates> >
+{
+   typedef backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> backend_type;
+   BOOST_STATIC_ASSERT_MSG(!backends::is_fixed_precision<backend_type>::value, "ntt_multiplier is only available for arbitrary precision integers.");
+
+ public:
+   typedef number<backend_type, ExpressionTemplates> number_type;
+
+   explicit ntt_multiplier(const number_type& x) : m_value(x), m_log_n(0) {}
+
+   const number_type& value() const { return m_value; }
+   //
+   // Sets result to value() * y:
+   //
+   void multiply(number_type& result, const number_type& y)
+   {
+      const backend_type& x  = m_value.backend();
+      unsigned            xs = x.size();
+      unsigned            ys = y.backend().size();
+      unsigned            cutoff = get_cpp_int_tuning().ntt_cutoff;
+      unsigned            wrap;
+      unsigned            log_n = (xs >= cutoff) && (ys >= cutoff) ? backends::ntt_transform_log(ys, xs, wrap) : 0;
+      if (!log_n || (log_n > backends::ntt_max_log))
+      {
+         result = m_value * y;
+         return;
+      }
+      if ((void*)&result == (void*)&y)
+      {
+         number_type t(y);
+         multiply(result, t);
+         return;
+      }
+      std::vector<limb_type> scratch(backends::ntt_storage_size(log_n, wrap));
+      if (log_n != m_log_n)
+      {
+         m_transform.resize(3u << log_n);
+         backends::ntt_transform_operand(&m_transform[0], x.limbs(), xs, log_n, &scratch[0]);
+         m_log_n = log_n;
+      }
+      bool s = x.sign() != y.backend().sign();
+      result.backend().resize(xs + ys, xs + ys);
+      backends::multiply_ntt(result.backend().limbs(), result.backend().size(), y.backend().limbs(), ys, x.limbs(), xs, log_n, wrap, &scratch[0], &m_transform[0]);
+      result.backend().normalize();
+      result.backend().sign(s);
+   }
+   number_type operator()(const number_type& y)
+   {
+      number_type result;
+      multiply(result, y);
+      return result;
+   }
+
+ private:
+   number_type            m_value;
+   std::vector<limb_type> m_transform;
+   unsigned               m_log_n;
+};
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// An allocator for cpp_int limbs which keeps freed blocks on per-thread free lists, one for each
+// power of two size from 16 bytes to 64K, and hands them out again rather than going back to
+// operator new.  Each list holds at most about 256K of memory, larger blocks aren't pooled at all,
+// and a thread's lists are released when it exits.  Blocks may be freed on a different thread from
+// the one which allocated them, as they all come from operator new in the end.
+//
+// Without thread_local support the allocator simply forwards to operator new and delete.
+//
+
+#ifndef BOOST_MP_CPP_INT_POOLED_ALLOCATOR_HPP
+#define BOOST_MP_CPP_INT_POOLED_ALLOCATOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <boost/throw_exception.hpp>
+#include <boost/multiprecision/detail/number_base.hpp>
+#include <boost/multiprecision/detail/bitscan.hpp>
+
+namespace boost { namespace multiprecision {
+
+namespace detail {
+
+static const unsigned    limb_pool_min_shift = 4;
+static const unsigned    limb_pool_bins      = 13;
+static const std::size_t limb_pool_bin_limit = 256 * 1024;
+
+struct limb_pool_state
+{
+   void*    free_list[limb_pool_bins];
+   unsigned cached[limb_pool_bins];
+   bool     registered, released;
+};
+
+inline unsigned limb_pool_bin(std::size_t bytes)
+{
+   return bytes <= (static_cast<std::size_t>(1u) << limb_pool_min_shift) ? 0 : find_msb(bytes - 1) + 1 - limb_pool_min_shift;
+}
+
+#ifdef BOOST_MP_USING_THREAD_LOCAL
+
+inline limb_pool_state& limb_pool()
+{
+   // Trivially destructible, so it's still usable by anything destroyed after the cleanup below:
+   static thread_local limb_pool_state state;
+   return state;
+}
+
+inline void release_limb_pool(limb_pool_state& s)
+{
+   for (unsigned bin = 0; bin < limb_pool_bins; ++bin)
+   {
+      while (void* p = s.free_list[bin])
+      {
+         s.free_list[bin] = *static_cast<void**>(p);
+         ::operator delete(p);
+      }
+      s.cached[bin] = 0;
+   }
+}
+
+struct limb_pool_cleanup
+{
+   ~limb_pool_cleanup()
+   {
+      limb_pool_state& s = limb_pool();
+      release_limb_pool(s);
+      s.released = true;
+   }
+};
+
+inline void* limb_pool_allocate(std::size_t bytes)
+{
+   unsigned bin = limb_pool_bin(bytes);
+   if (bin >= limb_pool_bins)
+      return ::operator new(bytes);
+   limb_pool_state& s = limb_pool();
+   if (void* p = s.free_list[bin])
+   {
+      s.free_list[bin] = *static_cast<void**>(p);
+      --s.cached[bin];
+      return p;
+   }
+   return ::operator new(static_cast<std::size_t>(1u) << (bin + limb_pool_min_shift));
+}
+
+inline void limb_pool_deallocate(void* p, std::size_t bytes)
+{
+   unsigned bin = limb_pool_bin(bytes);
+   if (bin < limb_pool_bins)
+   {
+      limb_pool_state& s = limb_pool();
+      if (!s.released && (s.cached[bin] < (std::max)(limb_pool_bin_limit >> (bin + limb_pool_min_shift), static_cast<std::size_t>(8u))))
+      {
+         if (!s.registered)
+         {
+            // The first block this thread keeps: arrange for the lists to be freed when it exits.
+            s.registered = true;
+            static thread_local limb_pool_cleanup cleanup;
+            (void)cleanup;
+         }
+         *static_cast<void**>(p) = s.free_list[bin];
+         s.free_list[bin]        = p;
+         ++s.cached[bin];
+         return;
+      }
+   }
+   ::operator delete(p);
+}
+
+#else
+
+inline void* limb_pool_allocate(std::size_t bytes)
+{
+   return ::operator new(bytes);
+}
+
+inline void limb_pool_deallocate(void* p, std::size_t)
+{
+   ::operator delete(p);
+}
+
+#endif
+
+} // namespace detail
+
+//
+// Returns the blocks cached by the calling thread to operator delete:
+//
+inline void release_thread_limb_pool()
+{
+#ifdef BOOST_MP_USING_THREAD_LOCAL
+   detail::release_limb_pool(detail::limb_pool());
+#endif
+}
+
+template <class T>
+class pooled_allocator
+{
+ public:
+   typedef T              value_type;
+   typedef T*             pointer;
+   typedef const T*       const_pointer;
+   typedef T&             reference;
+   typedef const T&       const_reference;
+   typedef std::size_t    size_type;
+   typedef std::ptrdiff_t difference_type;
+
+   template <class U>
+   struct rebind
+   {
+      typedef pooled_allocator<U> other;
+   };
+
+   pooled_allocator() BOOST_NOEXCEPT {}
+   template <class U>
+   pooled_allocator(const pooled_allocator<U>&) BOOST_NOEXCEPT {}
+
+   T* allocate(size_type n, const void* = 0)
+   {
+      if (n > max_size())
+         BOOST_THROW_EXCEPTION(std::bad_alloc());
+      return static_cast<T*>(detail::limb_pool_allocate(n * sizeof(T)));
+   }
+   void deallocate(T* p, size_type n) BOOST_NOEXCEPT
+   {
+      detail::limb_pool_deallocate(p, n * sizeof(T));
+   }
+   size_type max_size() const BOOST_NOEXCEPT
+   {
+      return ~static_cast<size_type>(0u) / sizeof(T);
+   }
+   void construct(T* p, const T& val) { ::new (static_cast<void*>(p)) T(val); }
+   void destroy(T* p) { p->~T(); }
+};
+
+template <class T, class U>
+inline bool operator==(const pooled_allocator<T>&, const pooled_allocator<U>&) BOOST_NOEXCEPT
+{
+   return true;
+}
+template <class T, class U>
+inline bool operator!=(const pooled_allocator<T>&, const pooled_allocator<U>&) BOOST_NOEXCEPT
+{
+   return false;
+}
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -0,0 +1,587 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Conversion of cpp_int_backend values to and from hexadecimal, octal and decimal digits.
+//
+// Hexadecimal and octal digits are a fixed number of bits each, so are read straight out of, or
+// packed straight into, the limbs in a single pass from the least significant end.
+//
+// Small values are repeatedly divided by the largest power of 10 which fits in a limb, in place
+// and a limb at a time.  Large values are split in two by dividing by 10^(digits_per_block_10 * 2^k)
+// for k such that the two halves are roughly the same size, and the halves are converted recursively.
+// The powers of 10 are found once for each conversion by repeated squaring, and the divisions use
+// Burnikel-Ziegler, so the whole conversion costs O(M(n) log n) rather than O(n^2).  Parsing
+// decimal digits is the same in reverse: long strings are split at digits_per_block_10 * 2^k
+// digits from the end, the two halves are parsed recursively, and recombined with a single
+// multiplication by the corresponding power of 10.
+//
+// The same routines write directly into, and parse directly from, caller supplied buffers
+// for to_chars() and from_chars(), and str() and stream output are built on them.
+//
+#ifndef BOOST_MP_CPP_INT_RADIX_HPP
+#define BOOST_MP_CPP_INT_RADIX_HPP
+
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+namespace boost { namespace multiprecision { namespace backends {
+
+//
+// The number of digits of digit_bits bits each needed for the magnitude of x, at least one:
+//
+template <class CppInt>
+std::size_t power_of_two_digit_count(const CppInt& x, unsigned digit_bits)
+{
+   std::size_t bits = (x.size() - 1) * static_cast<std::size_t>(CppInt::limb_bits) + 1;
+   if (x.limbs()[x.size() - 1])
+      bits += boost::multiprecision::detail::find_msb(x.limbs()[x.size() - 1]);
+   return (bits + digit_bits - 1) / digit_bits;
+}
+//
+// Writes the magnitude of x as digits of digit_bits bits each (3 for octal or 4 for hexadecimal)
+// into [first, last), right aligned.  Only the least significant last - first digits are written,
+// and if there are fewer than that the rest are zero:
+//
+template <class CppInt>
+void power_of_two_to_chars(const CppInt& x, unsigned digit_bits, bool uppercase, char* first, char* last)
+{
+   const char*     table = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+   const limb_type mask  = (static_cast<limb_type>(1u) << digit_bits) - 1;
+
+   typename CppInt::const_limb_pointer p = x.limbs();
+   unsigned                            n = x.size();
+   limb_type                           acc      = 0;
+   unsigned                            acc_bits = 0;
+   for (unsigned i = 0; (last != first) && (i < n);)
+   {
+      if (acc_bits >= digit_bits)
+      {
+         *--last = table[acc & mask];
+         acc >>= digit_bits;
+         acc_bits -= digit_bits;
+      }
+      else if ((digit_bits == 4) && !acc_bits && (last - first >= static_cast<std::ptrdiff_t>(CppInt::limb_bits / 4)))
+      {
+         // Whole limbs of hex digits, which is almost all of them:
+         limb_type v = p[i++];
+         for (unsigned j = 0; j < CppInt::limb_bits / 4; ++j, v >>= 4)
+            *--last = table[v & 15u];
+      }
+      else
+      {
+         // The digit straddles two limbs:
+         limb_type next = p[i++];
+         *--last        = table[(acc | (next << acc_bits)) & mask];
+         acc            = next >> (digit_bits - acc_bits);
+         acc_bits += CppInt::limb_bits - digit_bits;
+      }
+   }
+   while ((last != first) && acc_bits)
+   {
+      *--last = table[acc & mask];
+      acc >>= digit_bits;
+      acc_bits = acc_bits > digit_bits ? acc_bits - digit_bits : 0;
+   }
+   std::fill(first, last, '0');
+}
+//
+// Sets the magnitude of result to the value of the digits [first, last) of digit_bits bits each.
+// For fixed precision types, unchecked values are truncated, and checked ones throw if the value
+// doesn't fit.  Throws std::runtime_error if any of the characters are not valid digits:
+//
+template <class CppInt>
+void power_of_two_from_chars(CppInt& result, const char* first, const char* last, unsigned digit_bits)
+{
+   const unsigned radix = 1u << digit_bits;
+   while ((first != last) && (*first == '0'))
+      ++first;
+   std::size_t bits = 0;
+   if (first != last)
+   {
+      unsigned lead = boost::multiprecision::detail::char_to_digit(*first);
+      if (lead >= radix)
+         BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected content found while parsing character string."));
+      bits = (last - first - 1) * static_cast<std::size_t>(digit_bits) + boost::multiprecision::detail::find_msb(lead) + 1;
+   }
+   std::size_t limbs = bits ? (bits - 1) / CppInt::limb_bits + 1 : 1;
+   result.resize(static_cast<unsigned>(limbs), static_cast<unsigned>(limbs)); // will throw if this is a checked integer that cannot be resized
+
+   typename CppInt::limb_pointer p        = result.limbs();
+   unsigned                      n        = result.size();
+   unsigned                      i        = 0;
+   limb_type                     acc      = 0;
+   unsigned                      acc_bits = 0;
+   while (last != first)
+   {
+      if ((digit_bits == 4) && !acc_bits && (last - first >= static_cast<std::ptrdiff_t>(CppInt::limb_bits / 4)))
+      {
+         // Whole limbs of hex digits, invalid digits are 16 so set bit 4 of "bad":
+         limb_type limb = 0;
+         unsigned  bad  = 0;
+         for (unsigned j = 0; j < CppInt::limb_bits; j += 4)
+         {
+            unsigned v = boost::multiprecision::detail::char_to_digit(*--last);
+            bad |= v;
+            limb |= static_cast<limb_type>(v) << j;
+         }
+         if (bad & 16u)
+            BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected content found while parsing character string."));
+         if (i < n)
+            p[i++] = limb;
+         continue;
+      }
+      limb_type v = boost::multiprecision::detail::char_to_digit(*--last);
+      if (v >= radix)
+         BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected content found while parsing character string."));
+      acc |= v << acc_bits;
+      acc_bits += digit_bits;
+      if (acc_bits >= CppInt::limb_bits)
+      {
+         if (i < n)
+            p[i++] = acc;
+         acc_bits -= CppInt::limb_bits;
+         acc = acc_bits ? v >> (digit_bits - acc_bits) : 0u;
+      }
+   }
+   if (i < n)
+      p[i++] = acc;
+   std::fill(p + i, p + n, static_cast<limb_type>(0u));
+   result.sign(false);
+   result.normalize();
+}
+//
+// Returns the quotient of u1 * 2^limb_bits + u0 by d, and sets r to the remainder.  d must be
+// normalised (its top bit set), u1 < d, and v = floor((2^(2 * limb_bits) - 1) / d) - 2^limb_bits.
+// See N. Moller and T. Granlund, "Improved division by invariant integers", IEEE Trans. Computers 60
+// (2011), algorithm 4: the quotient is estimated with a multiplication by v, then corrected:
+//
+inline limb_type divide_double_limb_preinv(limb_type u1, limb_type u0, limb_type d, limb_type v, limb_type& r)
+{
+   const unsigned   limb_bits = sizeof(limb_type) * CHAR_BIT;
+   double_limb_type q         = static_cast<double_limb_type>(v) * u1 + ((static_cast<double_limb_type>(u1) << limb_bits) | u0);
+   limb_type        q1        = static_cast<limb_type>(q >> limb_bits) + 1;
+   limb_type        q0        = static_cast<limb_type>(q);
+   r                          = u0 - q1 * d;
+   if (r > q0)
+   {
+      --q1;
+      r += d;
+   }
+   if (r >= d)
+   {
+      ++q1;
+      r -= d;
+   }
+   return q1;
+}
+//
+// Writes the decimal digits of the magnitude of x into [first, last), right aligned and padded with
+// leading zeros.  There must be room for all the digits.  x is used as scratch space, and is left
+// holding garbage:
+//
+template <class CppInt>
+void decimal_to_chars_basecase(CppInt& x, char* first, char* last)
+{
+   //
+   // Each pass divides x in place by max_block_10, shifted left by s so that it's normalised.
+   // The limbs of x are shifted by the same amount as we go, which leaves the quotient unchanged:
+   //
+   const unsigned  s = CppInt::limb_bits - 1 - boost::multiprecision::detail::find_msb(max_block_10);
+   const limb_type d = max_block_10 << s;
+   const limb_type v = static_cast<limb_type>(~static_cast<double_limb_type>(0u) / d);
+
+   typename CppInt::limb_pointer p = x.limbs();
+   unsigned                      n = x.size();
+   while ((n > 1) || *p)
+   {
+      limb_type r = p[n - 1] >> (CppInt::limb_bits - s);
+      for (unsigned i = n; i-- > 0;)
+      {
+         limb_type u0 = p[i] << s;
+         if (i)
+            u0 |= p[i - 1] >> (CppInt::limb_bits - s);
+         p[i] = divide_double_limb_preinv(r, u0, d, v, r);
+      }
+      if ((n > 1) && !p[n - 1])
+         --n;
+      limb_type digits = r >> s;
+      for (unsigned i = 0; i < digits_per_block_10; ++i)
+      {
+         if (last == first)
+         {
+            BOOST_ASSERT(!digits && (n == 1) && !*p);
+            break;
+         }
+         *--last = static_cast<char>('0' + digits % 10);
+         digits /= 10;
+      }
+   }
+   std::fill(first, last, '0');
+}
+//
+// As above, for x of the working type, with powers[k] = 10^(digits_per_block_10 * 2^k):
+//
+template <class CppInt>
+void decimal_to_chars_recursive(CppInt& x, char* first, char* last, const std::vector<CppInt>& powers)
+{
+   if (x.size() < get_cpp_int_tuning().decimal_conversion_cutoff)
+   {
+      decimal_to_chars_basecase(x, first, last);
+      return;
+   }
+   //
+   // Split at the largest power no more than half the size of x, the remainder then
+   // fills exactly digits_per_block_10 * 2^k characters:
+   //
+   unsigned k = static_cast<unsigned>(powers.size());
+   while (--k && (2 * powers[k].size() > x.size() + 1))
+      ;
+   CppInt q, r;
+   divide_unsigned_helper(&q, x, powers[k], r);
+   std::size_t low_digits = static_cast<std::size_t>(digits_per_block_10) << k;
+   BOOST_ASSERT(static_cast<std::size_t>(last - first) >= low_digits);
+   decimal_to_chars_recursive(r, last - low_digits, last, powers);
+   decimal_to_chars_recursive(q, first, last - low_digits, powers);
+}
+//
+// Entry point from cpp_int_backend::str(), as for decimal_to_chars_basecase:
+//
+template <class CppInt>
+void decimal_to_chars(CppInt& x, char* first, char* last)
+{
+   if (x.size() < get_cpp_int_tuning().decimal_conversion_cutoff)
+   {
+      decimal_to_chars_basecase(x, first, last);
+      return;
+   }
+   typedef typename unbounded_working_type<CppInt>::type working_type;
+
+   working_type w(x);
+   w.sign(false);
+   std::vector<working_type> powers;
+   powers.reserve(std::numeric_limits<unsigned>::digits);
+   powers.push_back(working_type(max_block_10));
+   while (2 * powers.back().size() <= w.size())
+   {
+      working_type p;
+      eval_multiply(p, powers.back(), powers.back());
+      powers.push_back(working_type());
+      powers.back().swap(p);
+   }
+   decimal_to_chars_recursive(w, first, last, powers);
+}
+//
+// An upper bound on the number of decimal digits in the magnitude of x, at least one:
+//
+template <class CppInt>
+std::size_t decimal_digit_count_bound(const CppInt& x)
+{
+   std::size_t bits = (x.size() - 1) * static_cast<std::size_t>(CppInt::limb_bits) + 1;
+   if (x.limbs()[x.size() - 1])
+      bits += boost::multiprecision::detail::find_msb(x.limbs()[x.size() - 1]);
+   // 0.30103 is a little more than log10(2):
+   return static_cast<std::size_t>(static_cast<double>(bits) * 0.30103) + 1;
+}
+//
+// Values up to this many limbs are converted to decimal in a copy on the stack:
+//
+static const unsigned to_chars_scratch_limbs = 32;
+//
+// An upper bound on the number of characters cpp_int_to_chars writes for x:
+//
+template <class CppInt>
+std::size_t cpp_int_to_chars_size(const CppInt& x, std::ios_base::fmtflags f)
+{
+   if ((f & std::ios_base::hex) == std::ios_base::hex)
+      return 2 + power_of_two_digit_count(x, 4);
+   if ((f & std::ios_base::oct) == std::ios_base::oct)
+      return 1 + power_of_two_digit_count(x, 3);
+   return 1 + decimal_digit_count_bound(x);
+}
+//
+// Writes x into [first, last) formatted as cpp_int_backend::str(0, f) does, and returns the end of the
+// characters written, or a null pointer if they don't fit.  Nothing is allocated unless x is more than
+// to_chars_scratch_limbs long, or [first, last) is shorter than cpp_int_to_chars_size(x, f) but the
+// decimal digits may still fit, in which case they have to be found somewhere else first:
+//
+template <class CppInt>
+char* cpp_int_to_chars(char* first, char* last, const CppInt& x, std::ios_base::fmtflags f)
+{
+   typedef cpp_int_backend<to_chars_scratch_limbs * sizeof(limb_type) * CHAR_BIT, to_chars_scratch_limbs * sizeof(limb_type) * CHAR_BIT, signed_magnitude, unchecked, void> scratch_type;
+
+   bool uppercase = (f & std::ios_base::uppercase) != 0;
+   if (((f & std::ios_base::hex) == std::ios_base::hex) || ((f & std::ios_base::oct) == std::ios_base::oct))
+   {
+      if (x.sign())
+         BOOST_THROW_EXCEPTION(std::runtime_error("Base 8 or 16 printing of negative numbers is not supported."));
+      unsigned    shift  = (f & std::ios_base::hex) == std::ios_base::hex ? 4 : 3;
+      const char* prefix = !(f & std::ios_base::showbase) ? "" : (shift == 3 ? "0" : (uppercase ? "0X" : "0x"));
+      std::size_t n      = power_of_two_digit_count(x, shift);
+      if (static_cast<std::size_t>(last - first) < std::strlen(prefix) + n)
+         return 0;
+      first = std::copy(prefix, prefix + std::strlen(prefix), first);
+      power_of_two_to_chars(x, shift, uppercase, first, first + n);
+      return first + n;
+   }
+   if (x.sign() || (f & std::ios_base::showpos))
+   {
+      if (first == last)
+         return 0;
+      *first++ = x.sign() ? '-' : '+';
+   }
+   std::size_t n = decimal_digit_count_bound(x);
+   std::string buffer;
+   char*       digits = first;
+   if (static_cast<std::size_t>(last - first) < n)
+   {
+      buffer.resize(n);
+      digits = &buffer[0];
+   }
+   if (x.size() <= to_chars_scratch_limbs)
+   {
+      scratch_type t(x);
+      decimal_to_chars(t, digits, digits + n);
+   }
+   else
+   {
+      CppInt t(x);
+      decimal_to_chars(t, digits, digits + n);
+   }
+   const char* p = digits;
+   while ((p != digits + n - 1) && (*p == '0'))
+      ++p;
+   if (static_cast<std::size_t>(last - first) < static_cast<std::size_t>(digits + n - p))
+      return 0;
+   return std::copy(p, const_cast<const char*>(digits + n), first);
+}
+//
+// Trivial types have no limbs to convert, so are widened first:
+//
+template <class CppInt>
+inline char* cpp_int_to_chars(char* first, char* last, const CppInt& x, std::ios_base::fmtflags f, const mpl::false_&)
+{
+   return cpp_int_to_chars(first, last, x, f);
+}
+template <class CppInt>
+inline char* cpp_int_to_chars(char* first, char* last, const CppInt& x, std::ios_base::fmtflags f, const mpl::true_&)
+{
+   typedef cpp_int_backend<2 * sizeof(double_limb_type) * CHAR_BIT, 2 * sizeof(double_limb_type) * CHAR_BIT, signed_magnitude, unchecked, void> wide_type;
+   return cpp_int_to_chars(first, last, wide_type(x), f);
+}
+template <class CppInt>
+inline std::size_t cpp_int_to_chars_size(const CppInt& x, std::ios_base::fmtflags f, const mpl::false_&)
+{
+   return cpp_int_to_chars_size(x, f);
+}
+template <class CppInt>
+inline std::size_t cpp_int_to_chars_size(const CppInt& x, std::ios_base::fmtflags f, const mpl::true_&)
+{
+   typedef cpp_int_backend<2 * sizeof(double_limb_type) * CHAR_BIT, 2 * sizeof(double_limb_type) * CHAR_BIT, signed_magnitude, unchecked, void> wide_type;
+   return cpp_int_to_chars_size(wide_type(x), f);
+}
+//
+// Sets result to the value of the decimal digits [first, last), digits_per_block_10 digits at a
+// time.  Fixed precision types overflow exactly as they would for the same multiplications and
+// additions written out by hand.  Throws std::runtime_error if any character is not a digit:
+//
+template <class CppInt>
+void decimal_from_chars_basecase(CppInt& result, const char* first, const char* last)
+{
+   using default_ops::eval_add;
+   using default_ops::eval_multiply;
+
+   //
+   // The first block takes up the odd digits, so that the rest are all full:
+   //
+   result          = static_cast<limb_type>(0u);
+   unsigned digits = static_cast<unsigned>(static_cast<std::size_t>(last - first) % digits_per_block_10);
+   if (!digits)
+      digits = static_cast<unsigned>(digits_per_block_10);
+   while (first != last)
+   {
+      limb_type block = 0;
+      for (unsigned i = 0; i < digits; ++i, ++first)
+      {
+         unsigned v = static_cast<unsigned>(static_cast<unsigned char>(*first)) - '0';
+         if (v > 9)
+            BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected character encountered in input."));
+         block = block * 10 + v;
+      }
+      eval_multiply(result, block_multiplier(digits - 1));
+      eval_add(result, block);
+      digits = digits_per_block_10;
+   }
+}
+//
+// As above, splitting off the last digits_per_block_10 * 2^k digits for the largest k which leaves
+// some in front, with powers[k] = 10^(digits_per_block_10 * 2^k).  A limb holds a little more than
+// digits_per_block_10 digits, so the cutoff in digits is roughly the same size as the one in limbs
+// used for output:
+//
+template <class CppInt>
+void decimal_from_chars_recursive(CppInt& result, const char* first, const char* last, const std::vector<CppInt>& powers)
+{
+   std::size_t n = static_cast<std::size_t>(last - first);
+   if (n < get_cpp_int_tuning().decimal_conversion_cutoff * static_cast<std::size_t>(digits_per_block_10))
+   {
+      decimal_from_chars_basecase(result, first, last);
+      return;
+   }
+   unsigned k = static_cast<unsigned>(powers.size());
+   while (--k && ((static_cast<std::size_t>(digits_per_block_10) << k) >= n))
+      ;
+   const char* split = last - (static_cast<std::size_t>(digits_per_block_10) << k);
+   CppInt      high, low;
+   decimal_from_chars_recursive(high, first, split, powers);
+   decimal_from_chars_recursive(low, split, last, powers);
+   eval_multiply(result, high, powers[k]);
+   eval_add(result, low);
+}
+//
+// Entry point from cpp_int_backend::operator=(const char*), as for decimal_from_chars_basecase.
+// Every power of 10 used is no larger than the value being parsed, so checked types throw only
+// if the result itself overflows:
+//
+template <class CppInt>
+void decimal_from_chars(CppInt& result, const char* first, const char* last)
+{
+   while ((first != last) && (*first == '0'))
+      ++first;
+   std::size_t n = static_cast<std::size_t>(last - first);
+   if (n < get_cpp_int_tuning().decimal_conversion_cutoff * static_cast<std::size_t>(digits_per_block_10))
+   {
+      decimal_from_chars_basecase(result, first, last);
+      return;
+   }
+   std::vector<CppInt> powers;
+   powers.reserve(std::numeric_limits<std::size_t>::digits);
+   powers.push_back(CppInt(max_block_10));
+   while ((static_cast<std::size_t>(digits_per_block_10) << powers.size()) < n)
+   {
+      CppInt p;
+      eval_multiply(p, powers.back(), powers.back());
+      powers.push_back(CppInt());
+      powers.back().swap(p);
+   }
+   decimal_from_chars_recursive(result, first, last, powers);
+}
+
+template <class CppInt>
+inline void assign_parsed_value(CppInt& result, CppInt& parsed)
+{
+   result.swap(parsed);
+}
+template <class CppInt, class Parsed>
+inline void assign_parsed_value(CppInt& result, const Parsed& parsed)
+{
+   result = parsed;
+}
+
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline to_chars_result eval_to_chars(char* first, char* last, const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val, std::streamsize, std::ios_base::fmtflags f)
+{
+   to_chars_result result = {last, std::errc::value_too_large};
+   if (char* end = cpp_int_to_chars(first, last, val, f, mpl::bool_<is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::value>()))
+   {
+      result.ptr = end;
+      result.ec  = std::errc();
+   }
+   return result;
+}
+
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline std::size_t eval_to_chars_size(const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val, std::streamsize, std::ios_base::fmtflags f)
+{
+   return cpp_int_to_chars_size(val, f, mpl::bool_<is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::value>());
+}
+
+#endif
+
+} // namespace backends
+//
+// Stream output formats values which fit on the stack there, rather than in a std::string:
+//
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+inline std::ostream& operator<<(std::ostream& os, const number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>& r)
+{
+   typedef mpl::bool_<backends::is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator> >::value> trivial_tag;
+   char buffer[256];
+   if (backends::cpp_int_to_chars_size(r.backend(), os.flags(), trivial_tag()) <= sizeof(buffer))
+   {
+      char* end = backends::cpp_int_to_chars(buffer, buffer + sizeof(buffer), r.backend(), os.flags(), trivial_tag());
+      return detail::write_padded(os, buffer, end - buffer);
+   }
+   std::string s = r.str(0, os.flags());
+   return detail::write_padded(os, s.data(), static_cast<std::streamsize>(s.size()));
+}
+
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+//
+// Parses the longest sequence of digits in base 2, 8, 10 or 16 at the start of [first, last), with
+// a leading '-' allowed for signed types only, and no base prefix or whitespace, as std::from_chars
+// does.  If there are no digits ec is std::errc::invalid_argument, and if the value doesn't fit in a
+// checked type it is std::errc::result_out_of_range; in both cases value is unchanged.  Otherwise
+// ptr points to the first character that isn't part of the number.  Unchecked fixed precision types
+// keep the low bits of values too large for them:
+//
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+from_chars_result from_chars(const char* first, const char* last, number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>& value, int base = 10)
+{
+   typedef cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>                 backend_type;
+   typedef typename backends::unbounded_working_type<backend_type>::type                   working_type;
+   //
+   // Checked types are parsed into an unbounded integer first so that overflow can be
+   // reported rather than thrown, as are trivial ones, which have no limbs to parse into:
+   //
+   typedef typename mpl::if_c<(Checked == checked) || backends::is_trivial_cpp_int<backend_type>::value, working_type, backend_type>::type parse_type;
+
+   BOOST_ASSERT((base == 2) || (base == 8) || (base == 10) || (base == 16));
+   from_chars_result result = {first, std::errc()};
+   bool              neg    = false;
+   if ((first != last) && (*first == '-') && (SignType == signed_magnitude))
+   {
+      neg = true;
+      ++first;
+   }
+   const char* end = detail::scan_digits(first, last, static_cast<unsigned>(base));
+   if (end == first)
+   {
+      result.ec = std::errc::invalid_argument;
+      return result;
+   }
+   result.ptr = end;
+
+   parse_type parsed;
+   if (base == 10)
+      backends::decimal_from_chars(parsed, first, end);
+   else
+      backends::power_of_two_from_chars(parsed, first, end, base == 16 ? 4 : (base == 8 ? 3 : 1));
+   if ((Checked == checked) && (backends::max_precision<backend_type>::value != UINT_MAX) && !eval_is_zero(parsed) && (eval_msb(parsed) >= backends::max_precision<backend_type>::value))
+   {
+      result.ec = std::errc::result_out_of_range;
+      return result;
+   }
+   backends::assign_parsed_value(value.backend(), parsed);
+   if (neg)
+      value.backend().negate();
+   return result;
+}
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+template <unsigned MinBits, unsigned MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+inline from_chars_result from_chars(std::string_view s, number<cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>& value, int base = 10)
+{
+   return from_chars(s.data(), s.data() + s.size(), value, base);
+}
+#endif
+
+#endif // BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+
+}} // namespace boost::multiprecision
+
+#endif
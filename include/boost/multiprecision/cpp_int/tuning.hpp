@@ -0,0 +1,186 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Crossover points between the algorithms used by cpp_int_backend arithmetic.
+//
+// Each has a compile-time default which may be changed by defining the corresponding
+// BOOST_MP_XXX_CUTOFF macro (performance/cpp_int_tuning.cpp measures suitable values for
+// the host machine and writes them out as a header of such macros), and a process-wide
+// runtime value initialised from it, which may be changed with set_cpp_int_tuning().
+//
+
+#ifndef BOOST_MP_CPP_INT_TUNING_HPP
+#define BOOST_MP_CPP_INT_TUNING_HPP
+
+#include <stdexcept>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+
+namespace boost { namespace multiprecision {
+
+namespace backends {
+//
+// Minimum number of limbs required for Karatsuba to be worthwhile:
+//
+#ifdef BOOST_MP_KARATSUBA_CUTOFF
+const size_t karatsuba_cutoff = BOOST_MP_KARATSUBA_CUTOFF;
+#else
+const size_t karatsuba_cutoff = 40;
+#endif
+//
+// Schoolbook squaring needs only half the multiplications, so holds out
+// against Karatsuba for rather longer:
+//
+#ifdef BOOST_MP_KARATSUBA_SQUARE_CUTOFF
+const size_t karatsuba_square_cutoff = BOOST_MP_KARATSUBA_SQUARE_CUTOFF;
+#else
+const size_t karatsuba_square_cutoff = 80;
+#endif
+//
+// Minimum number of limbs required for Toom-Cook 3-way and 4-way multiplication
+// to be worthwhile, both sit on top of Karatsuba and are dispatched to from within
+// the same recursion:
+//
+#ifdef BOOST_MP_TOOM3_CUTOFF
+const size_t toom3_cutoff = BOOST_MP_TOOM3_CUTOFF;
+#else
+const size_t toom3_cutoff = 150;
+#endif
+#ifdef BOOST_MP_TOOM4_CUTOFF
+const size_t toom4_cutoff = BOOST_MP_TOOM4_CUTOFF;
+#else
+const size_t toom4_cutoff = 400;
+#endif
+//
+// Minimum number of limbs (in both arguments) for the NTT to beat Toom-Cook:
+//
+#ifdef BOOST_MP_NTT_CUTOFF
+const size_t ntt_cutoff = BOOST_MP_NTT_CUTOFF;
+#else
+const size_t ntt_cutoff = 2000;
+#endif
+//
+// Minimum number of limbs (in both the divisor and the quotient) for
+// Burnikel-Ziegler recursive division to beat schoolbook division:
+//
+#ifdef BOOST_MP_BURNIKEL_ZIEGLER_CUTOFF
+const size_t burnikel_ziegler_cutoff = BOOST_MP_BURNIKEL_ZIEGLER_CUTOFF;
+#else
+const size_t burnikel_ziegler_cutoff = 50;
+#endif
+//
+// Minimum number of limbs (in the smaller argument) for the half-gcd
+// to beat Lehmer's algorithm:
+//
+#ifdef BOOST_MP_HGCD_CUTOFF
+const size_t hgcd_cutoff = BOOST_MP_HGCD_CUTOFF;
+#else
+const size_t hgcd_cutoff = 1000;
+#endif
+//
+// Minimum number of limbs for divide and conquer conversion to decimal to beat
+// repeated division by a power of 10 which fits in a limb:
+//
+#ifdef BOOST_MP_DECIMAL_CONVERSION_CUTOFF
+const size_t decimal_conversion_cutoff = BOOST_MP_DECIMAL_CONVERSION_CUTOFF;
+#else
+const size_t decimal_conversion_cutoff = 200;
+#endif
+//
+// Smallest value we accept for any of the above, the recursive routines
+// need a few limbs to split up:
+//
+const unsigned min_tuning_cutoff = 8;
+
+BOOST_STATIC_ASSERT_MSG((karatsuba_cutoff <= toom3_cutoff) && (toom3_cutoff <= toom4_cutoff) && (toom4_cutoff <= ntt_cutoff),
+                        "The cpp_int multiplication cutoffs must satisfy karatsuba <= toom3 <= toom4 <= ntt.");
+BOOST_STATIC_ASSERT_MSG((karatsuba_cutoff <= karatsuba_square_cutoff) && (karatsuba_cutoff <= burnikel_ziegler_cutoff),
+                        "The cpp_int squaring and division cutoffs may not be below the Karatsuba cutoff.");
+
+} // namespace backends
+
+//
+// The runtime crossover points, all measured in limbs.  Fixed precision types may be
+// used in constant expressions, so for those the decision whether to use Karatsuba at
+// all is always made with the compile-time values, but everything else, including all
+// the recursive steps, uses these:
+//
+struct cpp_int_tuning
+{
+   unsigned karatsuba_cutoff;
+   unsigned karatsuba_square_cutoff;
+   unsigned toom3_cutoff;
+   unsigned toom4_cutoff;
+   unsigned ntt_cutoff;
+   unsigned burnikel_ziegler_cutoff;
+   unsigned hgcd_cutoff;
+   unsigned decimal_conversion_cutoff;
+};
+
+namespace backends {
+
+inline cpp_int_tuning& cpp_int_tuning_data() BOOST_NOEXCEPT
+{
+   // Constant initialised, so there's no thread safety issue in getting here first:
+   static cpp_int_tuning data = {
+       static_cast<unsigned>(karatsuba_cutoff),
+       static_cast<unsigned>(karatsuba_square_cutoff),
+       static_cast<unsigned>(toom3_cutoff),
+       static_cast<unsigned>(toom4_cutoff),
+       static_cast<unsigned>(ntt_cutoff),
+       static_cast<unsigned>(burnikel_ziegler_cutoff),
+       static_cast<unsigned>(hgcd_cutoff),
+       static_cast<unsigned>(decimal_conversion_cutoff)};
+   return data;
+}
+
+} // namespace backends
+
+inline cpp_int_tuning default_cpp_int_tuning() BOOST_NOEXCEPT
+{
+   cpp_int_tuning result = {
+       static_cast<unsigned>(backends::karatsuba_cutoff),
+       static_cast<unsigned>(backends::karatsuba_square_cutoff),
+       static_cast<unsigned>(backends::toom3_cutoff),
+       static_cast<unsigned>(backends::toom4_cutoff),
+       static_cast<unsigned>(backends::ntt_cutoff),
+       static_cast<unsigned>(backends::burnikel_ziegler_cutoff),
+       static_cast<unsigned>(backends::hgcd_cutoff),
+       static_cast<unsigned>(backends::decimal_conversion_cutoff)};
+   return result;
+}
+
+inline const cpp_int_tuning& get_cpp_int_tuning() BOOST_NOEXCEPT
+{
+   return backends::cpp_int_tuning_data();
+}
+//
+// Changes the crossover points for the whole process.  This is not synchronised with
+// arithmetic in other threads, so should be called once at startup before any such
+// threads are launched.
+//
+// The multiplication tiers must come in order, karatsuba <= toom3 <= toom4 <= ntt, since
+// the scratch space for a product is reserved up front on the assumption that each tier
+// only hands down to the ones below it.  Squaring, Burnikel-Ziegler division and Barrett
+// reduction (which uses the Karatsuba cutoff) all rely on sub-quadratic multiplication, so
+// their cutoffs may not be below the Karatsuba one either:
+//
+inline void set_cpp_int_tuning(const cpp_int_tuning& t)
+{
+   if ((t.karatsuba_cutoff < backends::min_tuning_cutoff) || (t.karatsuba_square_cutoff < backends::min_tuning_cutoff)
+      || (t.toom3_cutoff < backends::min_tuning_cutoff) || (t.toom4_cutoff < backends::min_tuning_cutoff)
+      || (t.ntt_cutoff < backends::min_tuning_cutoff) || (t.burnikel_ziegler_cutoff < backends::min_tuning_cutoff)
+      || (t.hgcd_cutoff < backends::min_tuning_cutoff) || (t.decimal_conversion_cutoff < backends::min_tuning_cutoff))
+      BOOST_THROW_EXCEPTION(std::domain_error("cpp_int tuning cutoffs must be at least 8 limbs."));
+   if ((t.toom3_cutoff < t.karatsuba_cutoff) || (t.toom4_cutoff < t.toom3_cutoff) || (t.ntt_cutoff < t.toom4_cutoff))
+      BOOST_THROW_EXCEPTION(std::domain_error("cpp_int multiplication cutoffs must satisfy karatsuba <= toom3 <= toom4 <= ntt."));
+   if ((t.karatsuba_square_cutoff < t.karatsuba_cutoff) || (t.burnikel_ziegler_cutoff < t.karatsuba_cutoff))
+      BOOST_THROW_EXCEPTION(std::domain_error("cpp_int squaring and division cutoffs may not be below the Karatsuba cutoff."));
+   backends::cpp_int_tuning_data() = t;
+}
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -0,0 +1,280 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// A compact, versioned binary format for number<> which needs neither Boost.Serialization nor any
+// particular byte order.  A block of data is:
+//
+// 'M' 'P' version kind varint(precision) varint(count) record...
+//
+// where kind identifies the record format (see binary_format below), precision is the precision
+// of the type which wrote the data, or zero when that's not a property of the type, and there are
+// count records, one per value.  Varints are 7 bits per byte, least significant group first, with
+// the top bit set on all but the last byte; signed values are zig-zag encoded first.  Multi-byte
+// quantities are always least significant byte first.
+//
+// Backends which have a native representation overload eval_write_binary, eval_read_binary and
+// specialize binary_format, everything else is written as the string returned by str().
+//
+
+#ifndef BOOST_MP_DETAIL_BINARY_IO_HPP
+#define BOOST_MP_DETAIL_BINARY_IO_HPP
+
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace boost { namespace multiprecision {
+
+namespace detail {
+
+static const unsigned char binary_io_version = 1;
+
+enum binary_format_kind
+{
+   binary_format_string        = 0, // varint(length) followed by the characters of str()
+   binary_format_integer       = 1, // varint(byte count * 2 + sign) followed by the magnitude
+   binary_format_binary_float  = 2, // see cpp_bin_float/binary_io.hpp
+   binary_format_decimal_float = 3  // see cpp_dec_float.hpp
+};
+
+//
+// Floating point records start with a byte holding the sign and class of the value:
+//
+static const unsigned char binary_class_zero     = 0;
+static const unsigned char binary_class_finite   = 1;
+static const unsigned char binary_class_infinity = 2;
+static const unsigned char binary_class_nan      = 3;
+static const unsigned char binary_class_mask     = 3;
+static const unsigned char binary_sign_flag      = 0x80;
+
+template <class Backend>
+struct binary_format
+{
+   static const unsigned char    kind      = binary_format_string;
+   static const boost::uintmax_t precision = 0;
+};
+
+template <class OutputIterator>
+class binary_writer
+{
+ public:
+   explicit binary_writer(OutputIterator out) : m_out(out) {}
+
+   void write_byte(unsigned char b)
+   {
+      *m_out = b;
+      ++m_out;
+   }
+   void write_varint(boost::uintmax_t v)
+   {
+      while (v >= 0x80u)
+      {
+         write_byte(static_cast<unsigned char>(v | 0x80u));
+         v >>= 7;
+      }
+      write_byte(static_cast<unsigned char>(v));
+   }
+   void write_signed_varint(boost::intmax_t v)
+   {
+      boost::uintmax_t u = static_cast<boost::uintmax_t>(v);
+      write_varint(v < 0 ? ~(u << 1) : u << 1);
+   }
+   //
+   // The low order bytes of v:
+   //
+   template <class Unsigned>
+   void write_bytes(Unsigned v, unsigned bytes)
+   {
+      for (unsigned i = 0; i < bytes; ++i)
+         write_byte(static_cast<unsigned char>(v >> (i * CHAR_BIT)));
+   }
+   OutputIterator position() const { return m_out; }
+
+ private:
+   OutputIterator m_out;
+};
+
+template <class InputIterator>
+class binary_reader
+{
+ public:
+   binary_reader(InputIterator first, InputIterator last) : m_first(first), m_last(last) {}
+
+   unsigned char read_byte()
+   {
+      if (m_first == m_last)
+         BOOST_THROW_EXCEPTION(std::runtime_error("Unexpected end of binary data."));
+      unsigned char b = static_cast<unsigned char>(*m_first);
+      ++m_first;
+      return b;
+   }
+   boost::uintmax_t read_varint()
+   {
+      static const unsigned digits = std::numeric_limits<boost::uintmax_t>::digits;
+      boost::uintmax_t      result = 0;
+      for (unsigned shift = 0;; shift += 7)
+      {
+         unsigned char b = read_byte();
+         // Too many bytes, or bits which don't fit:
+         if ((shift >= digits) || ((shift > digits - 7) && ((b & 0x7Fu) >> (digits - shift))))
+            invalid();
+         result |= static_cast<boost::uintmax_t>(b & 0x7Fu) << shift;
+         if (!(b & 0x80u))
+            return result;
+      }
+   }
+   boost::intmax_t read_signed_varint()
+   {
+      boost::uintmax_t u = read_varint();
+      return (u & 1u) ? static_cast<boost::intmax_t>(~(u >> 1)) : static_cast<boost::intmax_t>(u >> 1);
+   }
+   template <class Unsigned>
+   Unsigned read_bytes(unsigned bytes)
+   {
+      Unsigned result = 0;
+      for (unsigned i = 0; i < bytes; ++i)
+         result |= static_cast<Unsigned>(read_byte()) << (i * CHAR_BIT);
+      return result;
+   }
+   BOOST_NORETURN void invalid() const
+   {
+      BOOST_THROW_EXCEPTION(std::runtime_error("Invalid binary data."));
+   }
+   InputIterator position() const { return m_first; }
+
+ private:
+   InputIterator m_first, m_last;
+};
+
+} // namespace detail
+
+namespace default_ops {
+
+template <class Writer, class Backend>
+void eval_write_binary(Writer& w, const Backend& val)
+{
+   std::string s = val.str(0, number_category<Backend>::value == number_kind_floating_point ? std::ios_base::scientific : std::ios_base::fmtflags(0));
+   w.write_varint(s.size());
+   for (std::string::const_iterator i = s.begin(); i != s.end(); ++i)
+      w.write_byte(static_cast<unsigned char>(*i));
+}
+
+template <class Reader, class Backend>
+void eval_read_binary(Reader& r, Backend& val)
+{
+   boost::uintmax_t n = r.read_varint();
+   std::string      s;
+   for (; n; --n)
+      s.push_back(static_cast<char>(r.read_byte()));
+   val = s.c_str();
+}
+
+} // namespace default_ops
+
+namespace detail {
+
+template <class Backend, class Writer>
+void write_binary_header(Writer& w, boost::uintmax_t count)
+{
+   w.write_byte('M');
+   w.write_byte('P');
+   w.write_byte(binary_io_version);
+   w.write_byte(binary_format<Backend>::kind);
+   w.write_varint(binary_format<Backend>::precision);
+   w.write_varint(count);
+}
+//
+// Checks that the data was written by a type with the same kind of records as Backend (precision
+// may differ), and returns the number of records:
+//
+template <class Backend, class Reader>
+boost::uintmax_t read_binary_header(Reader& r)
+{
+   if ((r.read_byte() != 'M') || (r.read_byte() != 'P'))
+      r.invalid();
+   if (r.read_byte() > binary_io_version)
+      BOOST_THROW_EXCEPTION(std::runtime_error("Binary data was written by a later version of this library."));
+   if (r.read_byte() != binary_format<Backend>::kind)
+      BOOST_THROW_EXCEPTION(std::runtime_error("Binary data holds a different kind of number."));
+   r.read_varint();
+   return r.read_varint();
+}
+
+} // namespace detail
+//
+// Writes val as a block of one record to the bytes at out, and returns the end of them:
+//
+template <class OutputIterator, class Backend, expression_template_option ExpressionTemplates>
+OutputIterator write_binary(OutputIterator out, const number<Backend, ExpressionTemplates>& val)
+{
+   using default_ops::eval_write_binary;
+   detail::binary_writer<OutputIterator> w(out);
+   detail::write_binary_header<Backend>(w, 1);
+   eval_write_binary(w, val.backend());
+   return w.position();
+}
+//
+// Writes the numbers [first, last) as a single block:
+//
+template <class OutputIterator, class ForwardIterator>
+OutputIterator write_binary(OutputIterator out, ForwardIterator first, ForwardIterator last)
+{
+   using default_ops::eval_write_binary;
+   typedef typename std::iterator_traits<ForwardIterator>::value_type::backend_type backend_type;
+   detail::binary_writer<OutputIterator>                                           w(out);
+   detail::write_binary_header<backend_type>(w, std::distance(first, last));
+   for (; first != last; ++first)
+      eval_write_binary(w, first->backend());
+   return w.position();
+}
+//
+// Reads a block of one record from [first, last) into val, and returns the end of it.  Throws
+// std::runtime_error if the data is malformed, or isn't a single number of the same kind as val,
+// in which case val is unchanged:
+//
+template <class InputIterator, class Backend, expression_template_option ExpressionTemplates>
+InputIterator read_binary(InputIterator first, InputIterator last, number<Backend, ExpressionTemplates>& val)
+{
+   using default_ops::eval_read_binary;
+   detail::binary_reader<InputIterator> r(first, last);
+   if (detail::read_binary_header<Backend>(r) != 1)
+      BOOST_THROW_EXCEPTION(std::runtime_error("Binary data holds more than one number."));
+   Backend t;
+   eval_read_binary(r, t);
+   val.backend().swap(t);
+   return r.position();
+}
+//
+// Reads a block of any number of records from [first, last) and appends them to values, which is
+// unchanged if an exception is thrown:
+//
+template <class InputIterator, class Backend, expression_template_option ExpressionTemplates, class Allocator>
+InputIterator read_binary(InputIterator first, InputIterator last, std::vector<number<Backend, ExpressionTemplates>, Allocator>& values)
+{
+   using default_ops::eval_read_binary;
+   detail::binary_reader<InputIterator>                       r(first, last);
+   boost::uintmax_t                                           count = detail::read_binary_header<Backend>(r);
+   std::vector<number<Backend, ExpressionTemplates>, Allocator> result(values.get_allocator());
+   //
+   // Don't trust count with the allocation until the data has been read:
+   //
+   result.reserve(static_cast<std::size_t>((std::min)(count, static_cast<boost::uintmax_t>(1024u))));
+   for (; count; --count)
+   {
+      result.push_back(number<Backend, ExpressionTemplates>());
+      eval_read_binary(r, result.back().backend());
+   }
+   if (values.empty())
+      values.swap(result);
+   else
+      values.insert(values.end(), result.begin(), result.end());
+   return r.position();
+}
+
+}} // namespace boost::multiprecision
+
+#endif
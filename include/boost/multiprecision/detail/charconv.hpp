@@ -0,0 +1,384 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// to_chars and from_chars for number<>, in the manner of <charconv>: values are written into, and
+// read from, ranges of characters supplied by the caller, and errors are reported with std::errc
+// rather than thrown.
+//
+// Backends which can format directly into a buffer overload eval_to_chars and eval_to_chars_size,
+// everything else goes via the backend's str() member.  Parsing copies the characters which make up
+// the number into a null terminated buffer (on the stack if it's short) for the backend's string
+// assignment, except for types which provide their own from_chars overload.
+//
+
+#ifndef BOOST_MP_DETAIL_CHARCONV_HPP
+#define BOOST_MP_DETAIL_CHARCONV_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+#include <system_error>
+#endif
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+#include <string_view>
+#endif
+
+namespace boost { namespace multiprecision {
+
+namespace detail {
+//
+// The value of digit c in any base up to 16, or 16 if c isn't a digit:
+//
+inline unsigned char_to_digit(char c)
+{
+   unsigned v = static_cast<unsigned>(static_cast<unsigned char>(c)) - '0';
+   if (v < 10)
+      return v;
+   v = (static_cast<unsigned>(static_cast<unsigned char>(c)) | 0x20u) - 'a';
+   return v < 6 ? v + 10 : 16;
+}
+
+inline const char* scan_digits(const char* first, const char* last, unsigned base)
+{
+   while ((first != last) && (char_to_digit(*first) < base))
+      ++first;
+   return first;
+}
+//
+// Returns the end of s if [first, last) starts with it, ignoring case, otherwise first:
+//
+inline const char* scan_word(const char* first, const char* last, const char* s)
+{
+   const char* p = first;
+   for (; *s; ++s, ++p)
+   {
+      if ((p == last) || ((static_cast<unsigned char>(*p) | 0x20u) != static_cast<unsigned char>(*s)))
+         return first;
+   }
+   return p;
+}
+//
+// Returns the end of the longest decimal floating point number at the start of [first, last),
+// with optional fraction and exponent, or first if there isn't one:
+//
+inline const char* scan_decimal_float(const char* first, const char* last)
+{
+   const char* p = scan_digits(first, last, 10);
+   bool        have_digits = p != first;
+   if ((p != last) && (*p == '.'))
+   {
+      const char* q = scan_digits(p + 1, last, 10);
+      if (have_digits || (q != p + 1))
+      {
+         have_digits = true;
+         p           = q;
+      }
+   }
+   if (!have_digits)
+      return first;
+   if ((p != last) && ((*p == 'e') || (*p == 'E')))
+   {
+      const char* q = p + 1;
+      if ((q != last) && ((*q == '+') || (*q == '-')))
+         ++q;
+      const char* r = scan_digits(q, last, 10);
+      if (r != q)
+         p = r;
+   }
+   return p;
+}
+
+template <class Number, int Category>
+inline bool is_infinite(const Number&, const mpl::int_<Category>&)
+{
+   return false;
+}
+
+template <class Number>
+inline bool is_infinite(const Number& val, const mpl::int_<number_kind_floating_point>&)
+{
+   return (boost::multiprecision::isinf)(val);
+}
+
+} // namespace detail
+
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+
+struct to_chars_result
+{
+   char*     ptr;
+   std::errc ec;
+};
+
+struct from_chars_result
+{
+   const char* ptr;
+   std::errc   ec;
+};
+
+namespace default_ops {
+
+template <class Backend>
+inline to_chars_result eval_to_chars(char* first, char* last, const Backend& val, std::streamsize digits, std::ios_base::fmtflags f)
+{
+   std::string     s      = val.str(digits, f);
+   to_chars_result result = {last, std::errc::value_too_large};
+   if (s.size() <= static_cast<std::size_t>(last - first))
+   {
+      result.ptr = std::copy(s.begin(), s.end(), first);
+      result.ec  = std::errc();
+   }
+   return result;
+}
+
+//
+// eval_to_chars_size gives an upper bound on the length of val.str(digits, f) from the size of
+// val and the precision of its type, without formatting it.  Types whose precision isn't known
+// at compile time, and rationals and complex numbers, are measured by formatting them:
+//
+template <class Backend, int Category>
+inline std::size_t eval_to_chars_size_imp(const Backend& val, std::streamsize digits, std::ios_base::fmtflags f, const mpl::int_<Category>&)
+{
+   return val.str(digits, f).size();
+}
+
+template <class Backend>
+std::size_t eval_to_chars_size_imp(const Backend& val, std::streamsize, std::ios_base::fmtflags f, const mpl::int_<number_kind_integer>&)
+{
+   //
+   // The digits of the magnitude, plus room for a sign or a base prefix:
+   //
+   if (eval_is_zero(val))
+      return 3;
+   std::size_t bits;
+   if (eval_get_sign(val) < 0)
+   {
+      Backend t(val);
+      t.negate();
+      bits = eval_msb(t) + 1;
+   }
+   else
+      bits = eval_msb(val) + 1;
+   if ((f & std::ios_base::hex) == std::ios_base::hex)
+      return (bits + 3) / 4 + 2;
+   if ((f & std::ios_base::oct) == std::ios_base::oct)
+      return (bits + 2) / 3 + 2;
+   return bits / 3 + 3;
+}
+
+template <class Backend>
+std::size_t eval_to_chars_size_imp(const Backend& val, std::streamsize digits, std::ios_base::fmtflags f, const mpl::int_<number_kind_floating_point>&)
+{
+   typedef std::numeric_limits<number<Backend, et_off> > limits;
+   if (!limits::is_specialized || (limits::max_digits10 <= 0))
+      return val.str(digits, f).size();
+   std::size_t precision = digits > 0 ? static_cast<std::size_t>(digits) : static_cast<std::size_t>(limits::max_digits10);
+   //
+   // Scientific format is a sign, the digits, a point, and an exponent no wider than that of the
+   // largest exponent of the type.  General format uses fixed notation only when the exponent is
+   // smaller than the precision, which fits in the same space:
+   //
+   std::size_t exponent_width = 2;
+   for (boost::intmax_t e = (std::max)(limits::max_exponent10, -limits::min_exponent10); e; e /= 10)
+      ++exponent_width;
+   std::size_t result = precision + exponent_width + 8;
+   if (((f & std::ios_base::fixed) == std::ios_base::fixed) && ((f & std::ios_base::scientific) != std::ios_base::scientific))
+   {
+      //
+      // Fixed format adds every digit before the point, or the zeros after it, to the precision:
+      //
+      int c = eval_fpclassify(val);
+      if ((c == FP_NORMAL) || (c == FP_SUBNORMAL))
+      {
+         Backend                         t;
+         typename Backend::exponent_type e = 0;
+         eval_frexp(t, val, &e);
+         result += static_cast<std::size_t>(e < 0 ? -static_cast<boost::intmax_t>(e) : static_cast<boost::intmax_t>(e)) / 3 + 1;
+      }
+   }
+   return result;
+}
+
+template <class Backend>
+inline std::size_t eval_to_chars_size(const Backend& val, std::streamsize digits, std::ios_base::fmtflags f)
+{
+   return eval_to_chars_size_imp(val, digits, f, mpl::int_<number_category<Backend>::value>());
+}
+
+} // namespace default_ops
+//
+// Writes val into [first, last) exactly as val.str(digits, f) would format it, with no null
+// terminator.  If there isn't room ec is std::errc::value_too_large and ptr is last, otherwise
+// ptr is the end of the characters written:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline to_chars_result to_chars(char* first, char* last, const number<Backend, ExpressionTemplates>& val, std::streamsize digits = 0, std::ios_base::fmtflags f = std::ios_base::fmtflags(0))
+{
+   using default_ops::eval_to_chars;
+   return eval_to_chars(first, last, val.backend(), digits, f);
+}
+//
+// A buffer size which is always large enough for to_chars(first, last, val, digits, f):
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline std::size_t to_chars_size(const number<Backend, ExpressionTemplates>& val, std::streamsize digits = 0, std::ios_base::fmtflags f = std::ios_base::fmtflags(0))
+{
+   using default_ops::eval_to_chars_size;
+   return eval_to_chars_size(val.backend(), digits, f);
+}
+//
+// Parses the longest number at the start of [first, last), as std::from_chars does: there's no
+// leading whitespace, '+' or base prefix, and '-' is accepted only by signed types.  Integers are
+// digits in the given base (8, 10 or 16), rationals the same with an optional '/' and denominator,
+// and anything else a decimal floating point number, "inf", "infinity" or "nan".  If there isn't a
+// number, or it's one the type can't hold such as a zero denominator, ec is std::errc::invalid_argument
+// and value is unchanged.  If the number is too large for the type ec is std::errc::result_out_of_range,
+// value is unchanged and ptr is the end of it, otherwise ptr is the end of it:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+from_chars_result from_chars(const char* first, const char* last, number<Backend, ExpressionTemplates>& value, int base = 10)
+{
+   BOOST_ASSERT((base == 8) || (base == 10) || (base == 16));
+   BOOST_ASSERT((base == 10) || (number_category<Backend>::value == number_kind_integer));
+
+   from_chars_result result = {first, std::errc::invalid_argument};
+   const char*       start  = first;
+   bool              neg    = false;
+   if ((first != last) && (*first == '-') && std::numeric_limits<number<Backend, ExpressionTemplates> >::is_signed)
+   {
+      neg = true;
+      ++first;
+   }
+   const char* end     = first;
+   const char* special = 0;
+   if (number_category<Backend>::value == number_kind_integer)
+      end = detail::scan_digits(first, last, base);
+   else if (number_category<Backend>::value == number_kind_rational)
+   {
+      end = detail::scan_digits(first, last, 10);
+      if ((end != first) && (end != last) && (*end == '/'))
+      {
+         const char* d = detail::scan_digits(end + 1, last, 10);
+         if (d != end + 1)
+            end = d;
+      }
+   }
+   else if ((end = detail::scan_decimal_float(first, last)) == first)
+   {
+      if ((end = detail::scan_word(first, last, "inf")) != first)
+      {
+         special = "inf";
+         end     = detail::scan_word(end, last, "inity");
+      }
+      else if ((end = detail::scan_word(first, last, "nan")) != first)
+      {
+         special = "nan";
+         neg     = false;
+         if ((end != last) && (*end == '('))
+         {
+            const char* p = end + 1;
+            while ((p != last) && ((*p == '_') || std::isalnum(static_cast<unsigned char>(*p))))
+               ++p;
+            if ((p != last) && (*p == ')'))
+               end = p + 1;
+         }
+      }
+   }
+   if (end == first)
+      return result;
+   result.ptr = end;
+   result.ec  = std::errc();
+   //
+   // Hand the backend a null terminated copy, with the prefix it needs for the base:
+   //
+   const char* prefix = base == 16 ? "0x" : (base == 8 ? "0" : "");
+   if (special)
+   {
+      first = special;
+      end   = special + 3;
+   }
+   std::size_t n = (neg ? 1 : 0) + std::strlen(prefix) + static_cast<std::size_t>(end - first) + 1;
+   char        buffer[128];
+   std::string long_buffer;
+   char*       s = buffer;
+   if (n > sizeof(buffer))
+   {
+      long_buffer.resize(n);
+      s = &long_buffer[0];
+   }
+   char* p = s;
+   if (neg && !special)
+      *p++ = '-';
+   p  = std::copy(prefix, prefix + std::strlen(prefix), p);
+   p  = std::copy(first, end, p);
+   *p = 0;
+   //
+   // The characters have all been checked, so the backend throws only for values it can't hold:
+   // a floating point type can reject the size of the exponent (cpp_dec_float with a plain
+   // runtime_error), and a rational a zero denominator (boost::bad_rational, a domain_error).
+   // Anything else, std::bad_alloc included, is not a problem with the input and propagates.
+   // Parse into a temporary so that value is left alone if it does:
+   //
+   number<Backend, ExpressionTemplates> t;
+#ifndef BOOST_NO_EXCEPTIONS
+   try
+   {
+#endif
+      t.backend() = const_cast<const char*>(s);
+#ifndef BOOST_NO_EXCEPTIONS
+   }
+   catch (const std::overflow_error&)
+   {
+      result.ec = std::errc::result_out_of_range;
+      return result;
+   }
+   catch (const std::range_error&)
+   {
+      result.ec = std::errc::result_out_of_range;
+      return result;
+   }
+   catch (const std::domain_error&)
+   {
+      if (number_category<Backend>::value != number_kind_rational)
+         throw;
+      result.ptr = start;
+      result.ec  = std::errc::invalid_argument;
+      return result;
+   }
+   catch (const std::runtime_error&)
+   {
+      if (number_category<Backend>::value != number_kind_floating_point)
+         throw;
+      result.ec = std::errc::result_out_of_range;
+      return result;
+   }
+#endif
+   if (!special && detail::is_infinite(t, mpl::int_<number_category<Backend>::value>()))
+   {
+      result.ec = std::errc::result_out_of_range;
+      return result;
+   }
+   if (special && neg)
+      t = -t;
+   value.swap(t);
+   return result;
+}
+
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+template <class Backend, expression_template_option ExpressionTemplates>
+inline from_chars_result from_chars(std::string_view s, number<Backend, ExpressionTemplates>& value, int base = 10)
+{
+   return from_chars(s.data(), s.data() + s.size(), value, base);
+}
+#endif
+
+#endif // BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+
+}} // namespace boost::multiprecision
+
+#endif
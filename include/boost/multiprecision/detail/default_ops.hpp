@@ -1678,7 +1678,7 @@ void BOOST_MP_CXX14_CONSTEXPR eval_sqrt_karatsuba(B& s, B& r, const B& x) {
     uint64_t rr;
     if (x.size() == 4) {
       eval_sqrt_karatsuba_base_case(limbs[0], limbs[1], limbs[2], limbs[3], rr, ss);
-      s = B(ss);
+      s = B(static_cast<boost::ulong_long_type>(ss));
       // The remainder r might not fit into a 64-bit integer, so we need to 
       // calculate the remainder here.
       B temp;
@@ -1691,8 +1691,8 @@ void BOOST_MP_CXX14_CONSTEXPR eval_sqrt_karatsuba(B& s, B& r, const B& x) {
       if (x.size() == 1) eval_sqrt_karatsuba_base_case(limbs[0], 0UL, 0UL, 0UL, rr, ss);
       else if (x.size() == 2) eval_sqrt_karatsuba_base_case(limbs[0], limbs[1], 0UL, 0UL, rr, ss);
       else /* if (x.size() == 3) */ eval_sqrt_karatsuba_base_case(limbs[0], limbs[1], limbs[2], 0UL, rr, ss);
-      s = B(ss);
-      r = B(rr);
+      s = B(static_cast<boost::ulong_long_type>(ss));
+      r = B(static_cast<boost::ulong_long_type>(rr));
     }
     return;
   }
@@ -1724,13 +1724,9 @@ void BOOST_MP_CXX14_CONSTEXPR eval_sqrt_karatsuba(B& s, B& r, const B& x) {
   eval_left_shift(r1, ell);
   eval_add(r1, a1);
   eval_add_default(s1_double, s1, s1);
-  eval_divide_default(div2, r1, s1_double);
-  // Compute the remainder.
-  // (It would be nice if there was a function that
-  // returns both quotient and remainder in one call).
-  B temp_prod;
-  eval_multiply_default(temp_prod, div2, s1_double);
-  eval_subtract_default(rem2, r1, temp_prod);
+  // Quotient and remainder in one go, for large values this is
+  // recursive (Burnikel-Ziegler) division:
+  eval_qr(r1, s1_double, div2, rem2);
 
   // Evaluate s.
   eval_left_shift(s, s1, ell);
@@ -1738,7 +1734,7 @@ void BOOST_MP_CXX14_CONSTEXPR eval_sqrt_karatsuba(B& s, B& r, const B& x) {
 
   // Evaluate r := rem2 * 2^\ell + a0 - div2^2.
   B div2_squared;
-  eval_multiply_default(div2_squared, div2, div2);
+  eval_multiply(div2_squared, div2, div2);
   eval_left_shift(r, rem2, ell);
   eval_add(r, a0);
   eval_subtract(r, div2_squared);
@@ -1790,10 +1786,35 @@ void BOOST_MP_CXX14_CONSTEXPR eval_newton_raphson_sqrt(B& s, B& r, const B& x) {
   eval_subtract_default(r, x, s);
 }
 
+//
+// eval_sqrt_karatsuba's base case and quarter split are written for 32-bit limbs,
+// every other backend uses the bit by bit method below:
+//
+template <class B, class Enable = void>
+struct has_32_bit_limbs : public mpl::false_
+{};
 template <class B>
-void BOOST_MP_CXX14_CONSTEXPR eval_integer_sqrt(B& s, B& r, const B& x)
+struct has_32_bit_limbs<B, typename enable_if_c<B::limb_bits == 32>::type> : public mpl::true_
+{};
+
+template <class B>
+void BOOST_MP_CXX14_CONSTEXPR eval_integer_sqrt_old(B& s, B& r, const B& x);
+
+template <class B>
+inline BOOST_MP_CXX14_CONSTEXPR void eval_integer_sqrt_imp(B& s, B& r, const B& x, const mpl::true_&)
 {
   eval_sqrt_karatsuba(s, r, x);
+}
+template <class B>
+inline BOOST_MP_CXX14_CONSTEXPR void eval_integer_sqrt_imp(B& s, B& r, const B& x, const mpl::false_&)
+{
+  eval_integer_sqrt_old(s, r, x);
+}
+
+template <class B>
+void BOOST_MP_CXX14_CONSTEXPR eval_integer_sqrt(B& s, B& r, const B& x)
+{
+  eval_integer_sqrt_imp(s, r, x, has_32_bit_limbs<B>());
   // eval_newton_raphson_sqrt(s, r, x);
 }
 
@@ -0,0 +1,174 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Optional per-thread counters of the memory allocations made by cpp_int, of the algorithms
+// chosen by cpp_int multiplication and division, and of cpp_bin_float normalization.
+//
+// Counting is enabled by defining BOOST_MP_INSTRUMENT_COUNTERS (for the whole program, as it
+// changes what the inline functions do), otherwise BOOST_MP_INSTRUMENT_COUNT expands to an empty
+// statement, and the counters all stay at zero.  The interface below is present either way, so
+// code which reports the counters needn't change between builds.  Without thread_local support
+// there is a single set of counters, which is only meaningful when one thread at a time does
+// arithmetic.
+//
+
+#ifndef BOOST_MP_DETAIL_INSTRUMENTATION_HPP
+#define BOOST_MP_DETAIL_INSTRUMENTATION_HPP
+
+#include <iomanip>
+#include <ostream>
+#include <boost/multiprecision/detail/number_base.hpp>
+
+namespace boost { namespace multiprecision {
+
+enum instrumentation_counter
+{
+   // Storage for cpp_int limbs:
+   counter_cpp_int_allocate,   // calls to the allocator for limbs, including scratch space
+   counter_cpp_int_deallocate, // calls to the allocator to free them
+   counter_cpp_int_limbs,      // total limbs allocated
+   counter_cpp_int_resize,     // resizes which outgrew the storage a value already had
+   // Multiplication, each top level call counts once under the first 4 headings, and the
+   // recursive algorithms count each step, including the schoolbook multiplications they end in:
+   counter_multiply_limb,           // one argument is a single limb
+   counter_multiply_fixed_width,    // unrolled kernel for small fixed precision types
+   counter_multiply_schoolbook,     // quadratic multiplication
+   counter_square_schoolbook,       // quadratic squaring
+   counter_multiply_recursive,      // entries to the Karatsuba / Toom-Cook / NTT recursion
+   counter_multiply_karatsuba,      // Karatsuba steps
+   counter_multiply_toom32,         // Toom-Cook 3 by 2 steps
+   counter_multiply_toom3,          // Toom-Cook 3-way steps
+   counter_multiply_toom4,          // Toom-Cook 4-way steps
+   counter_multiply_unbalanced,     // slicing of very unbalanced arguments
+   counter_multiply_ntt,            // number theoretic transforms
+   // Division:
+   counter_divide_limb,             // single limb divisor
+   counter_divide_schoolbook,       // long division
+   counter_divide_burnikel_ziegler, // entries to recursive division
+   // cpp_bin_float:
+   counter_bin_float_normalize,     // results normalized and rounded
+   counter_bin_float_shift,         // ... of which had to be shifted left, after cancellation
+   counter_bin_float_round,         // ... of which had surplus bits to round away
+   instrumentation_counter_count
+};
+
+struct instrumentation_counters
+{
+   unsigned long long values[instrumentation_counter_count];
+
+   unsigned long long  operator[](instrumentation_counter c) const { return values[c]; }
+   unsigned long long& operator[](instrumentation_counter c) { return values[c]; }
+};
+
+//
+// The difference between two snapshots, so that the cost of a piece of code can be found:
+//
+inline instrumentation_counters operator-(const instrumentation_counters& a, const instrumentation_counters& b)
+{
+   instrumentation_counters result;
+   for (unsigned i = 0; i < instrumentation_counter_count; ++i)
+      result.values[i] = a.values[i] - b.values[i];
+   return result;
+}
+
+inline const char* instrumentation_counter_name(instrumentation_counter c)
+{
+   static const char* const names[instrumentation_counter_count] = {
+       "cpp_int_allocate",
+       "cpp_int_deallocate",
+       "cpp_int_limbs",
+       "cpp_int_resize",
+       "multiply_limb",
+       "multiply_fixed_width",
+       "multiply_schoolbook",
+       "square_schoolbook",
+       "multiply_recursive",
+       "multiply_karatsuba",
+       "multiply_toom32",
+       "multiply_toom3",
+       "multiply_toom4",
+       "multiply_unbalanced",
+       "multiply_ntt",
+       "divide_limb",
+       "divide_schoolbook",
+       "divide_burnikel_ziegler",
+       "bin_float_normalize",
+       "bin_float_shift",
+       "bin_float_round"};
+   return c < instrumentation_counter_count ? names[c] : "";
+}
+
+//
+// Writes one "name value" line for each counter which isn't zero:
+//
+template <class charT, class traits>
+inline std::basic_ostream<charT, traits>& operator<<(std::basic_ostream<charT, traits>& os, const instrumentation_counters& c)
+{
+   for (unsigned i = 0; i < instrumentation_counter_count; ++i)
+   {
+      if (c.values[i])
+         os << std::left << std::setw(26) << instrumentation_counter_name(static_cast<instrumentation_counter>(i)) << std::right << c.values[i] << "\n";
+   }
+   return os;
+}
+
+#ifdef BOOST_MP_INSTRUMENT_COUNTERS
+static const bool instrumentation_enabled = true;
+#else
+static const bool instrumentation_enabled = false;
+#endif
+
+namespace detail {
+
+inline instrumentation_counters& thread_counters() BOOST_NOEXCEPT
+{
+   // Constant initialised, and trivially destructible:
+   static BOOST_MP_THREAD_LOCAL instrumentation_counters counters;
+   return counters;
+}
+
+inline void instrument_count(instrumentation_counter c, unsigned long long n = 1) BOOST_NOEXCEPT
+{
+   thread_counters().values[c] += n;
+}
+
+} // namespace detail
+
+//
+// A snapshot of the calling thread's counters, and a way to zero them:
+//
+inline instrumentation_counters thread_instrumentation_counters() BOOST_NOEXCEPT
+{
+   return detail::thread_counters();
+}
+
+inline void reset_thread_instrumentation_counters() BOOST_NOEXCEPT
+{
+   detail::thread_counters() = instrumentation_counters();
+}
+
+}} // namespace boost::multiprecision
+
+//
+// BOOST_MP_INSTRUMENT_COUNT(counter_xxx) counts one event, or adds n with BOOST_MP_INSTRUMENT_ADD.
+// BOOST_MP_INSTRUMENT_COUNT_RUNTIME(counter_xxx, x) is for constexpr functions, and counts only when
+// not in a constant expression, x being some runtime variable in the caller which the fallback
+// form of BOOST_MP_IS_CONST_EVALUATED needs:
+//
+#ifdef BOOST_MP_INSTRUMENT_COUNTERS
+#define BOOST_MP_INSTRUMENT_COUNT(counter) ::boost::multiprecision::detail::instrument_count(::boost::multiprecision::counter)
+#define BOOST_MP_INSTRUMENT_ADD(counter, n) ::boost::multiprecision::detail::instrument_count(::boost::multiprecision::counter, n)
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+#define BOOST_MP_INSTRUMENT_COUNT_RUNTIME(counter, x) (BOOST_MP_IS_CONST_EVALUATED(x) ? (void)0 : BOOST_MP_INSTRUMENT_COUNT(counter))
+#else
+#define BOOST_MP_INSTRUMENT_COUNT_RUNTIME(counter, x) BOOST_MP_INSTRUMENT_COUNT(counter)
+#endif
+#else
+#define BOOST_MP_INSTRUMENT_COUNT(counter) ((void)0)
+#define BOOST_MP_INSTRUMENT_ADD(counter, n) ((void)0)
+#define BOOST_MP_INSTRUMENT_COUNT_RUNTIME(counter, x) ((void)0)
+#endif
+
+#endif
@@ -7,6 +7,7 @@
 #define BOOST_MP_INT_FUNC_HPP
 
 #include <boost/multiprecision/number.hpp>
+#include <vector>
 
 namespace boost { namespace multiprecision {
 
@@ -122,6 +123,297 @@ inline BOOST_MP_CXX14_CONSTEXPR void eval_lcm(B& result, const B& a, const B& b)
    if (eval_get_sign(result) < 0)
       result.negate();
 }
+//
+// Given g = gcd(a, b) and any s with s * |a| = g (mod |b|), sets s and t to the cofactors returned
+// by gcdext: s * a + t * b = g with -|b| / 2g < |s| * sign(a) <= |b| / 2g, or if b is zero s = sign(a)
+// and t = 0.  s may not alias a, b or g:
+//
+template <class B>
+inline void eval_gcdext_cofactors(const B& a, const B& b, const B& g, B& s, B& t)
+{
+   typedef typename mpl::front<typename B::unsigned_types>::type ui_type;
+
+   int sa = eval_get_sign(a);
+   int sb = eval_get_sign(b);
+   if (sb == 0)
+   {
+      s = static_cast<ui_type>(sa ? 1u : 0u);
+      if (sa < 0)
+         s.negate();
+      t = static_cast<ui_type>(0u);
+      return;
+   }
+   B ua(a), ub(b), m;
+   if (sa < 0)
+      ua.negate();
+   if (sb < 0)
+      ub.negate();
+   //
+   // Reduce s modulo |b| / g into (-|b| / 2g, |b| / 2g]:
+   //
+   eval_divide(m, ub, g);
+   eval_modulus(s, m);
+   if (eval_get_sign(s) < 0)
+      eval_add(s, m);
+   eval_add(t, s, s);
+   if (t.compare(m) > 0)
+      eval_subtract(s, m);
+   eval_multiply(m, s, ua);
+   eval_subtract(t, g, m);
+   eval_divide(t, ub);
+   if (sa < 0)
+      s.negate();
+   if (sb < 0)
+      t.negate();
+}
+//
+// Extended Euclidean algorithm, tracking only the cofactors of |a|:
+//
+template <class B>
+inline void eval_gcdext(const B& a, const B& b, B& g, B& s, B& t)
+{
+   typedef typename mpl::front<typename B::unsigned_types>::type ui_type;
+
+   B u(a), v(b), su, sv, q, r, tt;
+   if (eval_get_sign(u) < 0)
+      u.negate();
+   if (eval_get_sign(v) < 0)
+      v.negate();
+   su = static_cast<ui_type>(1u);
+   sv = static_cast<ui_type>(0u);
+   while (!eval_is_zero(v))
+   {
+      eval_qr(u, v, q, r);
+      u.swap(v);
+      v.swap(r);
+      eval_multiply(q, sv);
+      eval_subtract(su, q);
+      su.swap(sv);
+   }
+   eval_gcdext_cofactors(a, b, u, su, tt);
+   g = u;
+   s = su;
+   t = tt;
+}
+//
+// The Jacobi symbol (a/n) for odd positive n, by the binary algorithm: factors of 2 are removed
+// from a using the second supplement to the law of quadratic reciprocity, then the arguments are
+// swapped (and reduced) using the law itself:
+//
+template <class B>
+inline int eval_jacobi(const B& a, const B& n)
+{
+   typedef typename mpl::front<typename B::unsigned_types>::type ui_type;
+
+   if ((eval_get_sign(n) <= 0) || !eval_bit_test(n, 0))
+      BOOST_THROW_EXCEPTION(std::domain_error("The Jacobi symbol requires an odd positive modulus."));
+   B x, y(n);
+   eval_modulus(x, a, y);
+   if (eval_get_sign(x) < 0)
+      eval_add(x, y);
+   int result = 1;
+   while (!eval_is_zero(x))
+   {
+      unsigned k = eval_lsb(x);
+      if (k)
+      {
+         eval_right_shift(x, k);
+         // (2/y) = -1 when y = 3 or 5 (mod 8):
+         if ((k & 1) && (eval_bit_test(y, 1) != eval_bit_test(y, 2)))
+            result = -result;
+      }
+      // Both x and y are odd, the sign changes when both are 3 (mod 4):
+      if (eval_bit_test(x, 1) && eval_bit_test(y, 1))
+         result = -result;
+      x.swap(y);
+      eval_modulus(x, y);
+   }
+   return y.compare(static_cast<ui_type>(1u)) == 0 ? result : 0;
+}
+//
+// Appends the primes p, first <= p <= last, to primes, using a sieve of the odd values:
+//
+inline void primes_between(unsigned first, unsigned last, std::vector<unsigned>& primes)
+{
+   if ((first <= 2) && (last >= 2))
+      primes.push_back(2);
+   if (last < 3)
+      return;
+   std::vector<bool> composite(static_cast<std::size_t>((last - 1) / 2)); // composite[i] is for 2i + 3
+   for (std::size_t i = 0; i < composite.size(); ++i)
+   {
+      if (composite[i])
+         continue;
+      boost::ulong_long_type p = 2 * i + 3;
+      if (p >= first)
+         primes.push_back(static_cast<unsigned>(p));
+      for (boost::ulong_long_type j = (p * p - 3) / 2; j < composite.size(); j += p)
+         composite[static_cast<std::size_t>(j)] = true;
+   }
+}
+//
+// The product of the values in [first, last), each of which fits in a single word, by binary
+// splitting, so that the operands of each multiplication are of about the same size, and larger
+// ones go to the sub-quadratic multiplication routines rather than being multiplied a word at a
+// time:
+//
+template <class B>
+void eval_binary_split_product(B& result, const boost::ulong_long_type* first, const boost::ulong_long_type* last)
+{
+   typedef typename boost::multiprecision::detail::canonical<boost::ulong_long_type, B>::type ui_type;
+
+   if (last - first <= 2)
+   {
+      result = static_cast<ui_type>(*first);
+      if (last - first == 2)
+         eval_multiply(result, static_cast<ui_type>(first[1]));
+      return;
+   }
+   const boost::ulong_long_type* mid = first + (last - first) / 2;
+   B                             a, b;
+   eval_binary_split_product(a, first, mid);
+   eval_binary_split_product(b, mid, last);
+   eval_multiply(result, a, b);
+}
+//
+// The product of factors, after packing as many as will fit into each word (which destroys the
+// contents of factors):
+//
+template <class B>
+void eval_product(B& result, std::vector<boost::ulong_long_type>& factors)
+{
+   typedef typename boost::multiprecision::detail::canonical<boost::ulong_long_type, B>::type ui_type;
+
+   std::size_t            words = 0;
+   boost::ulong_long_type word  = 1;
+   for (std::size_t i = 0; i < factors.size(); ++i)
+   {
+      if (word <= (~static_cast<boost::ulong_long_type>(0u)) / factors[i])
+         word *= factors[i];
+      else
+      {
+         factors[words++] = word;
+         word             = factors[i];
+      }
+   }
+   if (!words)
+      result = static_cast<ui_type>(word);
+   else
+   {
+      factors[words++] = word;
+      eval_binary_split_product(result, &factors[0], &factors[0] + words);
+   }
+}
+//
+// n! by the prime swing method: n! = odd(n) * 2^(n - popcount(n)), where odd(n) is the odd part of
+// n!, and odd(n) = odd(n/2)^2 * swing(n), swing(n) being the odd part of n! / (n/2)!^2.  The
+// exponent of the prime p in swing(n) is the number of odd values among n/p, n/p^2, ... so is
+// easily found, and swing(n) is then a product of primes (most to the first power), which we
+// multiply together by binary splitting:
+//
+template <class B>
+void eval_factorial(B& result, unsigned n)
+{
+   typedef typename boost::multiprecision::detail::canonical<boost::ulong_long_type, B>::type ui_type;
+
+   if (n <= 20)
+   {
+      boost::ulong_long_type f = 1;
+      for (unsigned i = 2; i <= n; ++i)
+         f *= i;
+      result = static_cast<ui_type>(f);
+      return;
+   }
+   std::vector<unsigned> primes;
+   primes_between(3, n, primes);
+   unsigned levels = 0;
+   while (n >> levels > 20)
+      ++levels;
+   //
+   // Start from odd(m) for the largest m = n / 2^k <= 20, and work back up to odd(n):
+   //
+   boost::ulong_long_type f = 1;
+   for (unsigned i = 2; i <= (n >> levels); ++i)
+      f *= i;
+   while (!(f & 1))
+      f >>= 1;
+   result = static_cast<ui_type>(f);
+   std::vector<boost::ulong_long_type> factors;
+   B                                   swing, t;
+   while (levels--)
+   {
+      unsigned m = n >> levels;
+      factors.clear();
+      for (std::size_t i = 0; (i < primes.size()) && (primes[i] <= m); ++i)
+      {
+         for (unsigned q = m / primes[i]; q; q /= primes[i])
+         {
+            if (q & 1)
+               factors.push_back(primes[i]);
+         }
+      }
+      eval_product(swing, factors);
+      eval_multiply(t, result, result);
+      eval_multiply(result, t, swing);
+   }
+   unsigned bits = 0;
+   for (unsigned i = n; i; i &= i - 1)
+      ++bits;
+   eval_left_shift(result, n - bits);
+}
+//
+// The product of the primes <= n:
+//
+template <class B>
+void eval_primorial(B& result, unsigned n)
+{
+   std::vector<unsigned> primes;
+   primes_between(2, n, primes);
+   std::vector<boost::ulong_long_type> factors(primes.begin(), primes.end());
+   eval_product(result, factors);
+}
+//
+// The binomial coefficient n! / (k! (n - k)!), with k <= n - k: the primes p > k come only from the
+// values n - k + 1, ..., n, so we divide the primes <= k out of those (sieving them a prime at a
+// time), and the primes <= k appear to the power given by Kummer's theorem, which is the number of
+// carries when adding k and n - k in base p.  The result is then the product of what's left of the
+// values and those prime powers, again by binary splitting.  Only the primes <= k are needed, which
+// matters when k is small and n large:
+//
+template <class B>
+void eval_binomial(B& result, unsigned n, unsigned k)
+{
+   typedef typename boost::multiprecision::detail::canonical<boost::ulong_long_type, B>::type ui_type;
+
+   if (k > n)
+   {
+      result = static_cast<ui_type>(0u);
+      return;
+   }
+   if (k > n - k)
+      k = n - k;
+   std::vector<boost::ulong_long_type> factors(k);
+   for (unsigned i = 0; i < k; ++i)
+      factors[i] = n - k + 1 + i;
+   std::vector<unsigned> primes;
+   primes_between(2, k, primes);
+   for (std::size_t i = 0; i < primes.size(); ++i)
+   {
+      unsigned p = primes[i];
+      for (boost::ulong_long_type j = p - 1 - (n - k) % p; j < k; j += p)
+      {
+         do
+            factors[static_cast<std::size_t>(j)] /= p;
+         while (factors[static_cast<std::size_t>(j)] % p == 0);
+      }
+      for (boost::ulong_long_type q = p; q <= n; q *= p)
+      {
+         if (n / q - k / q - (n - k) / q)
+            factors.push_back(p);
+      }
+   }
+   eval_product(result, factors);
+}
 
 } // namespace default_ops
 
@@ -158,6 +450,65 @@ divide_qr(const multiprecision::detail::expression<tag, A1, A2, A3, A4>& x, cons
    divide_qr(number<Backend, ExpressionTemplates>(x), number<Backend, ExpressionTemplates>(y), q, r);
 }
 
+//
+// Sets g = gcd(a, b) along with the Bezout cofactors s and t, such that s * a + t * b = g.  Of the
+// infinitely many such pairs we return the one with -|b| / 2g < s * sign(a) <= |b| / 2g (and so
+// |t| <= |a| / 2g), except that when b is zero s = sign(a) and t = 0:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename enable_if_c<(number_category<Backend>::value == number_kind_integer) && is_signed_number<Backend>::value>::type
+gcdext(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& b,
+       number<Backend, ExpressionTemplates>& g, number<Backend, ExpressionTemplates>& s, number<Backend, ExpressionTemplates>& t)
+{
+   using default_ops::eval_gcdext;
+   eval_gcdext(a.backend(), b.backend(), g.backend(), s.backend(), t.backend());
+}
+
+//
+// The Jacobi symbol (a/n), which is 0, 1 or -1.  Throws std::domain_error unless n is odd and positive:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline typename enable_if_c<number_category<Backend>::value == number_kind_integer, int>::type
+jacobi(const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& n)
+{
+   using default_ops::eval_jacobi;
+   return eval_jacobi(a.backend(), n.backend());
+}
+
+//
+// n!, n! / (k! (n - k)!) (which is zero when k > n), and the product of the primes <= n, for some
+// integer type I, as in factorial<cpp_int>(n):
+//
+template <class I>
+inline typename enable_if_c<is_number<I>::value && (number_category<I>::value == number_kind_integer), I>::type
+factorial(unsigned n)
+{
+   using default_ops::eval_factorial;
+   I result;
+   eval_factorial(result.backend(), n);
+   return result;
+}
+
+template <class I>
+inline typename enable_if_c<is_number<I>::value && (number_category<I>::value == number_kind_integer), I>::type
+binomial(unsigned n, unsigned k)
+{
+   using default_ops::eval_binomial;
+   I result;
+   eval_binomial(result.backend(), n, k);
+   return result;
+}
+
+template <class I>
+inline typename enable_if_c<is_number<I>::value && (number_category<I>::value == number_kind_integer), I>::type
+primorial(unsigned n)
+{
+   using default_ops::eval_primorial;
+   I result;
+   eval_primorial(result.backend(), n);
+   return result;
+}
+
 template <class Backend, expression_template_option ExpressionTemplates, class Integer>
 inline BOOST_MP_CXX14_CONSTEXPR typename enable_if<mpl::and_<is_integral<Integer>, mpl::bool_<number_category<Backend>::value == number_kind_integer> >, Integer>::type
 integer_modulus(const number<Backend, ExpressionTemplates>& x, Integer val)
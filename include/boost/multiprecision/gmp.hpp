@@ -1902,6 +1902,21 @@ inline typename enable_if_c<is_signed<I>::value && ((sizeof(I) <= sizeof(long)))
    mpz_lcm_ui(result.data(), a.data(), boost::multiprecision::detail::unsigned_abs(b));
 }
 
+inline void eval_factorial(gmp_int& result, unsigned n)
+{
+   mpz_fac_ui(result.data(), n);
+}
+inline void eval_binomial(gmp_int& result, unsigned n, unsigned k)
+{
+   mpz_bin_uiui(result.data(), n, k);
+}
+#if (__GNU_MP_VERSION > 5) || ((__GNU_MP_VERSION == 5) && (__GNU_MP_VERSION_MINOR >= 1))
+inline void eval_primorial(gmp_int& result, unsigned n)
+{
+   mpz_primorial_ui(result.data(), n);
+}
+#endif
+
 inline void eval_integer_sqrt(gmp_int& s, gmp_int& r, const gmp_int& x)
 {
    mpz_sqrtrem(s.data(), r.data(), x.data());
@@ -189,6 +189,33 @@ BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<is_integral<Integer>::value, Integ
    return val;
 }
 
+template <class Integer>
+typename enable_if_c<is_integral<Integer>::value, int>::type jacobi(const Integer& a, const Integer& n)
+{
+   if ((n <= 0) || !(n & 1))
+      BOOST_THROW_EXCEPTION(std::domain_error("The Jacobi symbol requires an odd positive modulus."));
+   Integer x = a % n, y = n;
+   if (x < 0)
+      x += n;
+   int result = 1;
+   while (x)
+   {
+      unsigned k = lsb(x);
+      if (k)
+      {
+         x >>= k;
+         if ((k & 1) && (((y & 7) == 3) || ((y & 7) == 5)))
+            result = -result;
+      }
+      if (((x & 3) == 3) && ((y & 3) == 3))
+         result = -result;
+      Integer t = y % x;
+      y         = x;
+      x         = t;
+   }
+   return y == 1 ? result : 0;
+}
+
 template <class Integer>
 BOOST_MP_CXX14_CONSTEXPR typename enable_if_c<is_integral<Integer>::value, Integer>::type sqrt(const Integer& x, Integer& r)
 {
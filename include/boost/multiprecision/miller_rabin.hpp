@@ -129,33 +129,136 @@ cast_to_unsigned(const I& val)
    return val.template convert_to<unsigned>();
 }
 
-} // namespace detail
+//
+// r = a * b % n for 0 <= a, b < n, via a type wide enough to hold the product when the arguments
+// have fixed precision.  These save the setup, and the result type conversions, of calling powm for
+// each squaring.  b is only converted when it isn't already of the type we multiply by:
+//
+template <class To, class From>
+inline typename enable_if_c<is_same<To, From>::value, const To&>::type modulus_operand(const From& b)
+{
+   return b;
+}
+template <class To, class From>
+inline typename disable_if_c<is_same<To, From>::value, To>::type modulus_operand(const From& b)
+{
+   return To(b);
+}
+template <class Backend, expression_template_option ExpressionTemplates, class Arg>
+inline void multiply_modulus_imp(number<Backend, ExpressionTemplates>& r, const number<Backend, ExpressionTemplates>& a, const Arg& b, const number<Backend, ExpressionTemplates>& n, const mpl::true_&)
+{
+   using default_ops::eval_modulus;
+   using default_ops::eval_multiply;
+   typedef typename mpl::if_c<is_integral<Arg>::value, typename canonical<Arg, Backend>::type, Backend>::type arg_type;
+   Backend t;
+   eval_multiply(t, a.backend(), modulus_operand<arg_type>(b));
+   eval_modulus(r.backend(), t, n.backend());
+}
+template <class Backend, expression_template_option ExpressionTemplates, class Arg>
+inline void multiply_modulus_imp(number<Backend, ExpressionTemplates>& r, const number<Backend, ExpressionTemplates>& a, const Arg& b, const number<Backend, ExpressionTemplates>& n, const mpl::false_&)
+{
+   using default_ops::eval_modulus;
+   using default_ops::eval_multiply;
+   typedef typename default_ops::double_precision_type<Backend>::type      double_type;
+   typedef typename mpl::if_c<is_integral<Arg>::value, typename canonical<Arg, double_type>::type, double_type>::type arg_type;
+   double_type x(a.backend()), t;
+   eval_multiply(t, x, modulus_operand<arg_type>(b));
+   eval_modulus(x, t, n.backend());
+   r.backend() = Backend(x);
+}
+template <class Backend, expression_template_option ExpressionTemplates>
+inline void multiply_modulus(number<Backend, ExpressionTemplates>& r, const number<Backend, ExpressionTemplates>& a, const number<Backend, ExpressionTemplates>& b, const number<Backend, ExpressionTemplates>& n)
+{
+   typedef typename default_ops::double_precision_type<Backend>::type double_type;
+   multiply_modulus_imp(r, a, b.backend(), n, is_same<double_type, Backend>());
+}
+template <class Backend, expression_template_option ExpressionTemplates>
+inline void multiply_modulus(number<Backend, ExpressionTemplates>& r, const number<Backend, ExpressionTemplates>& a, unsigned b, const number<Backend, ExpressionTemplates>& n)
+{
+   typedef typename default_ops::double_precision_type<Backend>::type double_type;
+   multiply_modulus_imp(r, a, b, n, is_same<double_type, Backend>());
+}
+template <class I>
+inline typename enable_if_c<is_integral<I>::value>::type multiply_modulus(I& r, const I& a, const I& b, const I& n)
+{
+   typename double_integer<I>::type t;
+   multiply(t, a, b);
+   r = integer_modulus(t, n);
+}
+template <class I>
+inline typename enable_if_c<is_integral<I>::value && !is_same<I, unsigned>::value>::type multiply_modulus(I& r, const I& a, unsigned b, const I& n)
+{
+   multiply_modulus(r, a, static_cast<I>(b), n);
+}
+//
+// y = y * y % n, multiplying y by itself so that the squaring routines are used:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline void square_modulus_imp(number<Backend, ExpressionTemplates>& y, const number<Backend, ExpressionTemplates>& n, const mpl::true_&)
+{
+   using default_ops::eval_modulus;
+   using default_ops::eval_multiply;
+   Backend t;
+   eval_multiply(t, y.backend(), y.backend());
+   eval_modulus(y.backend(), t, n.backend());
+}
+template <class Backend, expression_template_option ExpressionTemplates>
+inline void square_modulus_imp(number<Backend, ExpressionTemplates>& y, const number<Backend, ExpressionTemplates>& n, const mpl::false_&)
+{
+   using default_ops::eval_modulus;
+   using default_ops::eval_multiply;
+   typedef typename default_ops::double_precision_type<Backend>::type double_type;
+   double_type x(y.backend()), t;
+   eval_multiply(t, x, x);
+   eval_modulus(x, t, n.backend());
+   y.backend() = Backend(x);
+}
+template <class Backend, expression_template_option ExpressionTemplates>
+inline void square_modulus(number<Backend, ExpressionTemplates>& y, const number<Backend, ExpressionTemplates>& n)
+{
+   typedef typename default_ops::double_precision_type<Backend>::type double_type;
+   square_modulus_imp(y, n, is_same<double_type, Backend>());
+}
+template <class I>
+inline typename enable_if_c<is_integral<I>::value>::type square_modulus(I& y, const I& n)
+{
+   multiply_modulus(y, y, y, n);
+}
 
+//
+// One Miller-Rabin round: true if n is a strong probable prime to base x, where n - 1 = q * 2^k
+// with q odd:
+//
+template <class I>
+bool strong_probable_prime(const I& n, const I& nm1, const I& q, unsigned k, const I& x)
+{
+   I y = powm(x, q, n);
+   if ((y == 1) || (y == nm1))
+      return true;
+   for (unsigned j = 1; j < k; ++j)
+   {
+      square_modulus(y, n);
+      if (y == nm1)
+         return true;
+      if (y == 1)
+         return false; // test failed
+   }
+   return false;
+}
+//
+// The Fermat and Miller-Rabin stages of miller_rabin_test, for odd n > 228 which is already
+// known to have no small factors:
+//
 template <class I, class Engine>
-typename enable_if_c<number_category<I>::value == number_kind_integer, bool>::type
-miller_rabin_test(const I& n, unsigned trials, Engine& gen)
+bool miller_rabin_trials(const I& n, unsigned trials, Engine& gen)
 {
-#ifdef BOOST_MSVC
-#pragma warning(push)
-#pragma warning(disable : 4127)
-#endif
    typedef I number_type;
 
-   if (n == 2)
-      return true; // Trivial special case.
-   if (bit_test(n, 0) == 0)
-      return false; // n is even
-   if (n <= 227)
-      return detail::is_small_prime(detail::cast_to_unsigned(n));
-
-   if (!detail::check_small_factors(n))
-      return false;
-
    number_type nm1 = n - 1;
    //
    // Begin with a single Fermat test - it excludes a lot of candidates:
    //
-   number_type q(228), x, y; // We know n is greater than this, as we've excluded small factors
+   number_type q(228), x; // We know n is greater than this, as we've excluded small factors
    x = powm(q, nm1, n);
    if (x != 1u)
       return false;
@@ -171,30 +274,183 @@ miller_rabin_test(const I& n, unsigned trials, Engine& gen)
    //
    for (unsigned i = 0; i < trials; ++i)
    {
-      x          = dist(gen);
-      y          = powm(x, q, n);
-      unsigned j = 0;
-      while (true)
+      x = dist(gen);
+      if (!strong_probable_prime(n, nm1, q, k, x))
+         return false;
+   }
+   return true; // Yeheh! probably prime.
+}
+//
+// Arithmetic modulo n on values in [0, n), written so as not to overflow fixed precision types:
+//
+template <class I>
+inline void add_modulus(I& a, const I& b, const I& n)
+{
+   I t = n - b;
+   if (a >= t)
+      a -= t;
+   else
+      a += b;
+}
+template <class I>
+inline void subtract_modulus(I& a, const I& b, const I& n)
+{
+   if (a >= b)
+      a -= b;
+   else
+      a += n - b;
+}
+template <class I>
+inline void halve_modulus(I& a, const I& n)
+{
+   // (a + n) / 2 when a is odd, as n is:
+   bool odd = bit_test(a, 0);
+   a >>= 1;
+   if (odd)
+   {
+      I h = n >> 1;
+      a += h;
+      ++a;
+   }
+}
+//
+// a = a * s % n for a small signed s:
+//
+template <class I>
+inline void multiply_modulus(I& a, int s, const I& n)
+{
+   multiply_modulus(a, a, static_cast<unsigned>(s < 0 ? -s : s), n);
+   if ((s < 0) && (a != 0))
+      a = n - a;
+}
+//
+// True if n > 0 is a perfect square, by Newton's method from above:
+//
+template <class I>
+bool is_square(const I& n)
+{
+   I x = I(1u) << (msb(n) / 2 + 1), y;
+   while (true)
+   {
+      y = n / x;
+      y += x;
+      y >>= 1;
+      if (y >= x)
+         return x * x == n;
+      x = y;
+   }
+}
+//
+// The strong Lucas probable prime test with parameters P = 1 and Q = (1 - D) / 4, for odd n with
+// no small factors and jacobi(D, n) = -1.  With n + 1 = d * 2^s and d odd, n passes if U(d) = 0,
+// or V(d * 2^r) = 0 for some 0 <= r < s.  We evaluate U(d), V(d) and Q^d left to right over the
+// bits of d, using U(2k) = U(k)V(k), V(2k) = V(k)^2 - 2Q^k, U(k+1) = (U(k) + V(k)) / 2 and
+// V(k+1) = (D U(k) + V(k)) / 2:
+//
+template <class I>
+bool strong_lucas_probable_prime(const I& n, int D)
+{
+   int Q = (1 - D) / 4;
+   I   d = n;
+   ++d;
+   unsigned s = lsb(d);
+   d >>= s;
+
+   I U(1u), V(1u), Qk, t;
+   Qk = Q < 0 ? I(n - static_cast<unsigned>(-Q)) : I(static_cast<unsigned>(Q));
+   for (int bit = static_cast<int>(msb(d)) - 1; bit >= 0; --bit)
+   {
+      multiply_modulus(U, U, V, n);
+      square_modulus(V, n);
+      subtract_modulus(V, Qk, n);
+      subtract_modulus(V, Qk, n);
+      square_modulus(Qk, n);
+      if (bit_test(d, static_cast<unsigned>(bit)))
       {
-         if (y == nm1)
-            break;
-         if (y == 1)
-         {
-            if (j == 0)
-               break;
-            return false; // test failed
-         }
-         if (++j == k)
-            return false; // failed
-         y = powm(y, 2, n);
+         t = U;
+         multiply_modulus(t, D, n);
+         add_modulus(U, V, n);
+         halve_modulus(U, n);
+         add_modulus(V, t, n);
+         halve_modulus(V, n);
+         multiply_modulus(Qk, Q, n);
       }
    }
-   return true; // Yeheh! probably prime.
+   if ((U == 0) || (V == 0))
+      return true;
+   for (unsigned r = 1; r < s; ++r)
+   {
+      square_modulus(V, n);
+      subtract_modulus(V, Qk, n);
+      subtract_modulus(V, Qk, n);
+      if (V == 0)
+         return true;
+      square_modulus(Qk, n);
+   }
+   return false;
+}
+//
+// The Baillie-PSW test for odd n > 228 with no small factors: a strong probable prime test to base
+// 2, followed by a strong Lucas test with D the first of 5, -7, 9, -11, 13 ... for which
+// jacobi(D, n) = -1 (Selfridge's method A):
+//
+template <class I>
+bool baillie_psw_trials(const I& n)
+{
+#ifdef BOOST_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4127)
+#endif
+   I nm1 = n - 1, q(nm1);
+   unsigned k = lsb(q);
+   q >>= k;
+   if (!strong_probable_prime(n, nm1, q, k, I(2u)))
+      return false;
+
+   int D = 5;
+   while (true)
+   {
+      I a = D < 0 ? I(n - static_cast<unsigned>(-D)) : I(static_cast<unsigned>(D));
+      int j = jacobi(a, n);
+      if (j == -1)
+         break;
+      if (j == 0)
+         return false; // n shares a factor with D, and is larger than it.
+      if (D == 13)
+      {
+         //
+         // No such D exists when n is a square, so check for that before going any further:
+         //
+         if (is_square(n))
+            return false;
+      }
+      D = D < 0 ? 2 - D : -2 - D;
+   }
+   return strong_lucas_probable_prime(n, D);
 #ifdef BOOST_MSVC
 #pragma warning(pop)
 #endif
 }
 
+} // namespace detail
+
+template <class I, class Engine>
+typename enable_if_c<number_category<I>::value == number_kind_integer, bool>::type
+miller_rabin_test(const I& n, unsigned trials, Engine& gen)
+{
+   if (n == 2)
+      return true; // Trivial special case.
+   if (bit_test(n, 0) == 0)
+      return false; // n is even
+   if (n <= 227)
+      return detail::is_small_prime(detail::cast_to_unsigned(n));
+
+   if (!detail::check_small_factors(n))
+      return false;
+
+   return detail::miller_rabin_trials(n, trials, gen);
+}
+
 template <class I>
 typename enable_if_c<number_category<I>::value == number_kind_integer, bool>::type
 miller_rabin_test(const I& x, unsigned trials)
@@ -203,6 +459,33 @@ miller_rabin_test(const I& x, unsigned trials)
    return miller_rabin_test(x, trials, gen);
 }
 
+//
+// The Baillie-PSW test, which has no known pseudoprimes, and none below 2^64:
+//
+template <class I>
+typename enable_if_c<number_category<I>::value == number_kind_integer, bool>::type
+baillie_psw_test(const I& n)
+{
+   if (n == 2)
+      return true;
+   if ((n < 2) || (bit_test(n, 0) == 0))
+      return false;
+   if (n <= 227)
+      return detail::is_small_prime(detail::cast_to_unsigned(n));
+
+   if (!detail::check_small_factors(n))
+      return false;
+
+   return detail::baillie_psw_trials(n);
+}
+
+template <class tag, class Arg1, class Arg2, class Arg3, class Arg4>
+bool baillie_psw_test(const detail::expression<tag, Arg1, Arg2, Arg3, Arg4>& n)
+{
+   typedef typename detail::expression<tag, Arg1, Arg2, Arg3, Arg4>::result_type number_type;
+   return baillie_psw_test(number_type(n));
+}
+
 template <class tag, class Arg1, class Arg2, class Arg3, class Arg4, class Engine>
 bool miller_rabin_test(const detail::expression<tag, Arg1, Arg2, Arg3, Arg4>& n, unsigned trials, Engine& gen)
 {
@@ -0,0 +1,239 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Miller-Rabin tests of many candidates at once, spread over a number of threads.  The work is
+// divided into items, each being a candidate, or when there are fewer candidates than threads, a
+// share of the trials for one candidate.  Worker threads take the next item from a shared counter
+// until none remain, and a candidate found to be composite is flagged so that the other items for
+// it stop at the end of their current trial.
+//
+// Each item draws its random bases from its own generator, seeded from the caller's seed, the
+// candidate's index and the item's share of the trials, so the streams are independent of one
+// another and the results don't depend on how the items happen to be scheduled.  Without thread
+// support the items are simply processed in turn on the calling thread.
+//
+
+#ifndef BOOST_MP_MILLER_RABIN_BATCH_HPP
+#define BOOST_MP_MILLER_RABIN_BATCH_HPP
+
+#include <iterator>
+#include <vector>
+#include <boost/multiprecision/miller_rabin.hpp>
+#include <boost/multiprecision/detail/atomic.hpp>
+
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_NO_CXX11_HDR_THREAD) && !defined(BOOST_MT_NO_ATOMIC_INT)
+#include <exception>
+#include <thread>
+#define BOOST_MP_MILLER_RABIN_BATCH_THREADS
+#endif
+
+namespace boost { namespace multiprecision {
+
+namespace detail {
+
+#ifdef BOOST_MP_MILLER_RABIN_BATCH_THREADS
+typedef atomic_unsigned_type batch_flag_type;
+#else
+typedef unsigned batch_flag_type;
+#endif
+
+template <class I>
+class miller_rabin_batch
+{
+ public:
+   miller_rabin_batch(const std::vector<I>& values, unsigned trials, unsigned threads, boost::uint32_t seed)
+       : m_values(values), m_composite(values.size()), m_next(0), m_stop(0), m_failed(0), m_trials(trials), m_threads(threads), m_seed(seed)
+   {
+      for (std::size_t i = 0; i < m_composite.size(); ++i)
+         m_composite[i] = 0;
+      //
+      // Split the trials of each candidate so there's an item for every thread:
+      //
+      m_parts = 1;
+      if (values.size() && (values.size() < threads))
+         m_parts = (threads + static_cast<unsigned>(values.size()) - 1) / static_cast<unsigned>(values.size());
+      if (m_parts > trials)
+         m_parts = trials ? trials : 1;
+      m_items = static_cast<unsigned>(values.size()) * m_parts;
+   }
+   void run()
+   {
+#ifdef BOOST_MP_MILLER_RABIN_BATCH_THREADS
+      unsigned threads = m_threads < m_items ? m_threads : m_items;
+      if (threads > 1)
+      {
+         {
+            //
+            // If starting a thread fails, the guard stops and joins the ones already running
+            // before the exception leaves:
+            //
+            std::vector<std::thread> workers;
+            join_guard               guard(*this, workers);
+            workers.reserve(threads - 1);
+            for (unsigned i = 1; i < threads; ++i)
+               workers.push_back(std::thread(&miller_rabin_batch::guarded_work, this));
+            guarded_work();
+            guard.completed = true;
+         }
+#ifndef BOOST_NO_EXCEPTIONS
+         if (m_error)
+            std::rethrow_exception(m_error);
+#endif
+         return;
+      }
+#endif
+      work();
+   }
+   bool is_probable_prime(std::size_t i) const { return !m_composite[i]; }
+
+ private:
+#ifdef BOOST_MP_MILLER_RABIN_BATCH_THREADS
+   struct join_guard
+   {
+      join_guard(miller_rabin_batch& b, std::vector<std::thread>& w) : batch(b), workers(w), completed(false) {}
+      ~join_guard()
+      {
+         if (!completed)
+            batch.m_stop = 1;
+         for (std::size_t i = 0; i < workers.size(); ++i)
+            workers[i].join();
+      }
+      miller_rabin_batch&       batch;
+      std::vector<std::thread>& workers;
+      bool                      completed;
+
+    private:
+      join_guard& operator=(const join_guard&);
+   };
+   //
+   // An exception on any thread stops the others, and the first one is rethrown by run() once
+   // they've all finished:
+   //
+   void guarded_work()
+   {
+#ifndef BOOST_NO_EXCEPTIONS
+      try
+      {
+#endif
+         work();
+#ifndef BOOST_NO_EXCEPTIONS
+      }
+      catch (...)
+      {
+         m_stop = 1;
+         if (m_failed++ == 0)
+            m_error = std::current_exception();
+      }
+#endif
+   }
+#endif
+   void work()
+   {
+      mt19937 gen;
+      for (unsigned item = m_next++; (item < m_items) && !m_stop; item = m_next++)
+      {
+         unsigned index = item / m_parts, part = item % m_parts;
+         if (m_composite[index])
+            continue;
+         boost::uint32_t seeds[3] = {m_seed, index, part};
+         boost::random::seed_seq seq(seeds, seeds + 3);
+         gen.seed(seq);
+         unsigned trials = m_trials / m_parts + (part < m_trials % m_parts ? 1 : 0);
+         if (!test(m_values[index], part == 0, trials, gen, m_composite[index], m_stop))
+            m_composite[index] = 1;
+      }
+   }
+   static bool test(const I& n, bool first_part, unsigned trials, mt19937& gen, const batch_flag_type& composite, const batch_flag_type& stop)
+   {
+      //
+      // The same as miller_rabin_test, except that only one item tests the small cases, and does
+      // the Fermat test, and that we stop as soon as any item finds the candidate composite, or
+      // another thread has failed:
+      //
+      if (n == 2)
+         return true;
+      if ((n < 2) || (bit_test(n, 0) == 0))
+         return false;
+      if (n <= 227)
+         return is_small_prime(cast_to_unsigned(n));
+      if (first_part)
+      {
+         if (!check_small_factors(n))
+            return false;
+         if (powm(I(228), I(n - 1), n) != 1)
+            return false;
+      }
+      I        nm1 = n - 1, q(nm1);
+      unsigned k   = lsb(q);
+      q >>= k;
+      boost::random::uniform_int_distribution<I> dist(2, n - 2);
+      for (unsigned i = 0; (i < trials) && !composite && !stop; ++i)
+      {
+         if (!strong_probable_prime(n, nm1, q, k, dist(gen)))
+            return false;
+      }
+      return true;
+   }
+
+   const std::vector<I>&        m_values;
+   std::vector<batch_flag_type> m_composite;
+   batch_flag_type              m_next, m_stop, m_failed;
+   unsigned                     m_trials, m_threads, m_parts, m_items;
+   boost::uint32_t              m_seed;
+#ifdef BOOST_MP_MILLER_RABIN_BATCH_THREADS
+   std::exception_ptr m_error;
+#endif
+};
+
+inline unsigned default_batch_threads()
+{
+#ifdef BOOST_MP_MILLER_RABIN_BATCH_THREADS
+   unsigned n = std::thread::hardware_concurrency();
+   return n ? n : 1;
+#else
+   return 1;
+#endif
+}
+
+} // namespace detail
+
+//
+// Writes miller_rabin_test(n, trials) for each n in [first, last) to out, in order, and returns the
+// end of the output.  threads = 0 uses one thread for each hardware thread.  The results depend
+// only on the values, trials and seed:
+//
+template <class Iterator, class OutputIterator>
+OutputIterator miller_rabin_test_batch(Iterator first, Iterator last, OutputIterator out, unsigned trials, unsigned threads = 0, boost::uint32_t seed = 0)
+{
+   typedef typename std::iterator_traits<Iterator>::value_type value_type;
+   std::vector<value_type>                                     values(first, last);
+   detail::miller_rabin_batch<value_type>                      batch(values, trials, threads ? threads : detail::default_batch_threads(), seed);
+   batch.run();
+   for (std::size_t i = 0; i < values.size(); ++i)
+      *out++ = batch.is_probable_prime(i);
+   return out;
+}
+//
+// As above, with the seed taken from gen:
+//
+template <class Iterator, class OutputIterator, class Engine>
+typename disable_if_c<is_arithmetic<Engine>::value, OutputIterator>::type
+miller_rabin_test_batch(Iterator first, Iterator last, OutputIterator out, unsigned trials, Engine& gen, unsigned threads = 0)
+{
+   return miller_rabin_test_batch(first, last, out, trials, threads, static_cast<boost::uint32_t>(gen()));
+}
+
+template <class I>
+std::vector<bool> miller_rabin_test_batch(const std::vector<I>& values, unsigned trials, unsigned threads = 0, boost::uint32_t seed = 0)
+{
+   std::vector<bool> result;
+   result.reserve(values.size());
+   miller_rabin_test_batch(values.begin(), values.end(), std::back_inserter(result), trials, threads, seed);
+   return result;
+}
+
+}} // namespace boost::multiprecision
+
+#endif
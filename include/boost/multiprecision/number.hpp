@@ -1998,21 +1998,33 @@ class number
    static BOOST_MP_FORCEINLINE typename detail::canonical<std::string, Backend>::type canonical_value(const std::string& v) BOOST_NOEXCEPT { return v.c_str(); }
 };
 
+namespace detail {
+//
+// Writes the n characters at p padded out to the width of the stream, as the output
+// of a string would be:
+//
+inline std::ostream& write_padded(std::ostream& os, const char* p, std::streamsize n)
+{
+   std::streamsize pad  = os.width() > n ? os.width() - n : 0;
+   char            fill = os.fill();
+   bool            left = (os.flags() & std::ios_base::left) == std::ios_base::left;
+   os.width(0);
+   for (std::streamsize i = 0; !left && (i < pad); ++i)
+      os.put(fill);
+   os.write(p, n);
+   for (std::streamsize i = 0; left && (i < pad); ++i)
+      os.put(fill);
+   return os;
+}
+
+} // namespace detail
+
 template <class Backend, expression_template_option ExpressionTemplates>
 inline std::ostream& operator<<(std::ostream& os, const number<Backend, ExpressionTemplates>& r)
 {
-   std::streamsize d  = os.precision();
-   std::string     s  = r.str(d, os.flags());
-   std::streamsize ss = os.width();
-   if (ss > static_cast<std::streamsize>(s.size()))
-   {
-      char fill = os.fill();
-      if ((os.flags() & std::ios_base::left) == std::ios_base::left)
-         s.append(static_cast<std::string::size_type>(ss - s.size()), fill);
-      else
-         s.insert(static_cast<std::string::size_type>(0), static_cast<std::string::size_type>(ss - s.size()), fill);
-   }
-   return os << s;
+   std::streamsize d = os.precision();
+   std::string     s = r.str(d, os.flags());
+   return detail::write_padded(os, s.data(), static_cast<std::streamsize>(s.size()));
 }
 
 namespace detail {
@@ -2231,6 +2243,8 @@ struct hash<boost::rational<boost::multiprecision::number<Backend, ExpressionTem
 
 #endif
 
+#include <boost/multiprecision/detail/charconv.hpp>
+#include <boost/multiprecision/detail/binary_io.hpp>
 #include <boost/multiprecision/detail/ublas_interop.hpp>
 
 #endif
@@ -0,0 +1,297 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Searching for primes and safe primes.  Rather than testing each candidate in turn, we sieve
+// a window of consecutive odd candidates against the odd primes below 2^16: the residues of the
+// start of the window modulo each sieving prime are found once (a few primes at a time, with one
+// pass over the big number for each group), after which marking off the multiples of each prime
+// in the window, and moving the residues on to the next window, needs only word sized arithmetic.
+// Only the survivors of the sieve go on to the Miller-Rabin tests.
+//
+
+#ifndef BOOST_MP_PRIME_GENERATION_HPP
+#define BOOST_MP_PRIME_GENERATION_HPP
+
+#include <stdexcept>
+#include <vector>
+#include <boost/multiprecision/miller_rabin.hpp>
+
+namespace boost { namespace multiprecision {
+
+namespace detail {
+
+inline std::vector<boost::uint16_t> make_sieve_primes()
+{
+   static const unsigned        limit = 1u << 16;
+   std::vector<bool>            composite(limit);
+   std::vector<boost::uint16_t> result;
+   for (unsigned i = 3; i < limit; i += 2)
+   {
+      if (!composite[i])
+      {
+         result.push_back(static_cast<boost::uint16_t>(i));
+         for (unsigned j = i * i; j < limit; j += 2 * i)
+            composite[j] = true;
+      }
+   }
+   return result;
+}
+//
+// The odd primes below 2^16:
+//
+inline const std::vector<boost::uint16_t>& sieve_primes()
+{
+   static const std::vector<boost::uint16_t> primes = make_sieve_primes();
+   return primes;
+}
+//
+// How many of those are worth sieving with for candidates of the given size: more primes remove
+// more candidates, but each costs a little for every window, while the Miller-Rabin tests they
+// save get more expensive as the candidates get larger:
+//
+inline unsigned sieve_prime_count(unsigned bits)
+{
+   std::size_t n = 64 + 8 * static_cast<std::size_t>(bits);
+   return static_cast<unsigned>((std::min)(n, sieve_primes().size()));
+}
+
+//
+// Sieves the odd values start, start + 2, start + 4, ... and, when "safe" is set, also the
+// values 2 * start + 1, 2 * start + 5, ... at the same time, so that a candidate survives only
+// if both it and twice it plus one have no small factors.
+//
+class prime_sieve
+{
+ public:
+   template <class I>
+   prime_sieve(const I& start, unsigned bits, unsigned size, bool safe)
+       : m_primes(sieve_primes()), m_count(sieve_prime_count(bits)), m_residues(m_count), m_composite(size), m_safe(safe)
+   {
+      BOOST_ASSERT(bit_test(start, 0));
+      //
+      // The residues of start, several primes at a time:
+      //
+      unsigned i = 0;
+      while (i < m_count)
+      {
+         boost::uint32_t product = m_primes[i];
+         unsigned        j       = i + 1;
+         while ((j < m_count) && (product <= ~static_cast<boost::uint32_t>(0u) / m_primes[j]))
+            product *= m_primes[j++];
+         boost::uint32_t r = integer_modulus(start, product);
+         for (; i < j; ++i)
+            m_residues[i] = r % m_primes[i];
+      }
+      //
+      // Small starting values may be one of the sieving primes, which mustn't be crossed off:
+      //
+      m_small_start = start < 0x10000 ? detail::cast_to_unsigned(start) : 0;
+      sieve();
+   }
+   unsigned size() const { return static_cast<unsigned>(m_composite.size()); }
+   //
+   // True if start + 2 * i was crossed off:
+   //
+   bool composite(unsigned i) const { return m_composite[i] != 0; }
+   //
+   // Moves start on by 2 * size(), and sieves again:
+   //
+   void next()
+   {
+      boost::uint32_t step = 2 * static_cast<boost::uint32_t>(m_composite.size());
+      for (unsigned k = 0; k < m_count; ++k)
+         m_residues[k] = (m_residues[k] + step % m_primes[k]) % m_primes[k];
+      if (m_small_start)
+         m_small_start = m_small_start + step < 0x10000 ? m_small_start + step : 0;
+      sieve();
+   }
+
+ private:
+   void cross_off(boost::uint32_t first, boost::uint32_t p, boost::uint32_t value_at_first)
+   {
+      unsigned size = static_cast<unsigned>(m_composite.size());
+      if (value_at_first == p)
+         first += p; // The prime itself is not composite.
+      for (; first < size; first += p)
+         m_composite[first] = 1;
+   }
+   void sieve()
+   {
+      std::fill(m_composite.begin(), m_composite.end(), static_cast<unsigned char>(0));
+      for (unsigned k = 0; k < m_count; ++k)
+      {
+         boost::uint32_t p    = m_primes[k];
+         boost::uint32_t inv2 = (p + 1) / 2; // The inverse of 2 modulo p.
+         boost::uint32_t r    = m_residues[k];
+         //
+         // start + 2 * i = 0 (mod p):
+         //
+         boost::uint32_t first = ((p - r) % p) * inv2 % p;
+         cross_off(first, p, m_small_start ? m_small_start + 2 * first : 0);
+         if (m_safe)
+         {
+            //
+            // 2 * (start + 2 * i) + 1 = 0 (mod p), that is start + 2 * i = (p - 1) / 2 (mod p):
+            //
+            first = ((p - 1) / 2 + p - r) % p * inv2 % p;
+            cross_off(first, p, m_small_start ? 2 * (m_small_start + 2 * first) + 1 : 0);
+         }
+      }
+   }
+
+   const std::vector<boost::uint16_t>& m_primes;
+   unsigned                            m_count;
+   std::vector<boost::uint32_t>        m_residues;
+   std::vector<unsigned char>          m_composite;
+   boost::uint32_t                     m_small_start;
+   bool                                m_safe;
+};
+//
+// The Miller-Rabin test for a value which has survived the sieve:
+//
+template <class I, class Engine>
+bool sieved_prime_test(const I& n, unsigned trials, Engine& gen)
+{
+   if (n <= 227)
+      return is_small_prime(cast_to_unsigned(n));
+   return miller_rabin_trials(n, trials, gen);
+}
+//
+// The first odd value >= start which is probably prime, or with "safe" set, such that 2 * value + 1
+// is also probably prime.  Gives up and returns 0 if none is found below limit (when not zero):
+//
+template <class I, class Engine>
+I sieve_search(const I& start, const I& limit, bool safe, unsigned trials, Engine& gen)
+{
+   unsigned bits = msb(start) + 1;
+   //
+   // Large enough that a window usually holds a prime (or the sieve survivors of a window hold
+   // a safe prime with reasonable probability), so that the sieve setup isn't repeated:
+   //
+   unsigned    size = safe ? 64 + 16 * bits : 64 + 2 * bits;
+   prime_sieve sieve(start, safe ? bits + 1 : bits, size, safe);
+   I           base(start), candidate;
+   while (true)
+   {
+      for (unsigned i = 0; i < sieve.size(); ++i)
+      {
+         if (sieve.composite(i))
+            continue;
+         candidate = base + 2 * i;
+         if (limit && (candidate > limit))
+            return I(0);
+         if (safe)
+         {
+            // Test the larger value first: Fermat's test rejects most composites at once.
+            I p = 2 * candidate + 1;
+            if (sieved_prime_test(p, 0, gen) && sieved_prime_test(candidate, trials, gen) && sieved_prime_test(p, trials, gen))
+               return candidate;
+         }
+         else if (sieved_prime_test(candidate, trials, gen))
+            return candidate;
+      }
+      base += 2 * sieve.size();
+      sieve.next();
+   }
+}
+
+} // namespace detail
+
+//
+// The smallest probable prime greater than n:
+//
+template <class I, class Engine>
+typename enable_if_c<number_category<I>::value == number_kind_integer, I>::type
+next_prime(const I& n, unsigned trials, Engine& gen)
+{
+   if (n < 2)
+      return I(2);
+   I start = n + 1;
+   if (!bit_test(start, 0))
+      ++start;
+   return detail::sieve_search(start, I(0), false, trials, gen);
+}
+
+template <class I>
+typename enable_if_c<number_category<I>::value == number_kind_integer, I>::type
+next_prime(const I& n, unsigned trials)
+{
+   static mt19937 gen;
+   return next_prime(n, trials, gen);
+}
+
+template <class tag, class Arg1, class Arg2, class Arg3, class Arg4, class Engine>
+typename detail::expression<tag, Arg1, Arg2, Arg3, Arg4>::result_type
+next_prime(const detail::expression<tag, Arg1, Arg2, Arg3, Arg4>& n, unsigned trials, Engine& gen)
+{
+   typedef typename detail::expression<tag, Arg1, Arg2, Arg3, Arg4>::result_type number_type;
+   return next_prime(number_type(n), trials, gen);
+}
+
+template <class tag, class Arg1, class Arg2, class Arg3, class Arg4>
+typename detail::expression<tag, Arg1, Arg2, Arg3, Arg4>::result_type
+next_prime(const detail::expression<tag, Arg1, Arg2, Arg3, Arg4>& n, unsigned trials)
+{
+   typedef typename detail::expression<tag, Arg1, Arg2, Arg3, Arg4>::result_type number_type;
+   return next_prime(number_type(n), trials);
+}
+
+//
+// A random probable prime of exactly "bits" bits: the candidates are drawn from gen, while the
+// Miller-Rabin tests use a separate generator seeded from it.
+//
+template <class I, class Engine>
+typename enable_if_c<number_category<I>::value == number_kind_integer, I>::type
+random_prime(unsigned bits, unsigned trials, Engine& gen)
+{
+   if (bits < 2)
+      BOOST_THROW_EXCEPTION(std::domain_error("random_prime requires at least 2 bits."));
+   if (bits == 2)
+      return I(boost::random::uniform_int_distribution<unsigned>(2, 3)(gen));
+   I                                       low = I(1) << (bits - 1), high = (I(1) << bits) - 1;
+   boost::random::uniform_int_distribution<I> dist(low, high);
+   mt19937                                 test_gen(static_cast<boost::uint32_t>(gen()));
+   while (true)
+   {
+      I start = dist(gen);
+      if (!bit_test(start, 0))
+         ++start;
+      I result = detail::sieve_search(start, high, false, trials, test_gen);
+      if (result != 0)
+         return result;
+   }
+}
+
+//
+// A random probable safe prime p of exactly "bits" bits, so that (p - 1) / 2 is also prime:
+//
+template <class I, class Engine>
+typename enable_if_c<number_category<I>::value == number_kind_integer, I>::type
+random_safe_prime(unsigned bits, unsigned trials, Engine& gen)
+{
+   if (bits < 3)
+      BOOST_THROW_EXCEPTION(std::domain_error("random_safe_prime requires at least 3 bits."));
+   //
+   // Search on q = (p - 1) / 2, which has one bit fewer, and which must be odd except for p = 5:
+   //
+   I                                       low = I(1) << (bits - 2), high = (I(1) << (bits - 1)) - 1;
+   boost::random::uniform_int_distribution<I> dist(low, high);
+   mt19937                                 test_gen(static_cast<boost::uint32_t>(gen()));
+   while (true)
+   {
+      I start = dist(gen);
+      if (start == 2)
+         return I(5);
+      if (!bit_test(start, 0))
+         ++start;
+      I q = detail::sieve_search(start, high, true, trials, test_gen);
+      if (q != 0)
+         return 2 * q + 1;
+   }
+}
+
+}} // namespace boost::multiprecision
+
+#endif
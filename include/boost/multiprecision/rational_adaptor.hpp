@@ -276,6 +276,14 @@ inline int eval_get_sign(const rational_adaptor<IntBackend>& val)
    return eval_get_sign(val.data().numerator().backend());
 }
 
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+template <class IntBackend>
+inline std::size_t eval_to_chars_size(const rational_adaptor<IntBackend>& val, std::streamsize digits, std::ios_base::fmtflags f)
+{
+   return to_chars_size(val.data().numerator(), digits, f) + 1 + to_chars_size(val.data().denominator(), digits, f);
+}
+#endif
+
 template <class IntBackend, class V>
 inline void assign_components(rational_adaptor<IntBackend>& result, const V& v1, const V& v2)
 {
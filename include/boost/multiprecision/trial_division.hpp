@@ -0,0 +1,228 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Trial division by all the primes up to some bound, using a product tree of those primes: the
+// leaves are products of consecutive primes which fit in a limb, and each node above is the
+// product of its two children.  To divide n by all the primes we reduce n modulo the nodes on the
+// way down the tree (a remainder tree), so that each reduction is by a product of about the same
+// size as the value being reduced, rather than dividing all of n by each small prime in turn.  The
+// remainders at the leaves then fit in a limb, and are checked against each prime with word sized
+// arithmetic.  Descending the left branches first gives the smallest factor, and stops there.
+//
+// For many candidates at once we build a second product tree over the candidates themselves, and
+// reduce the product of all the primes down that tree instead, so that one pass gives the product
+// of the primes modulo each candidate, and a gcd with that tells us whether the candidate has any
+// factor below the bound.
+//
+
+#ifndef BOOST_MP_TRIAL_DIVISION_HPP
+#define BOOST_MP_TRIAL_DIVISION_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <boost/multiprecision/cpp_int.hpp>
+
+#ifndef BOOST_MP_TRIAL_DIVISION_LEAF_BITS
+#define BOOST_MP_TRIAL_DIVISION_LEAF_BITS 2048
+#endif
+
+namespace boost { namespace multiprecision {
+
+namespace detail {
+//
+// Each level of a product tree is half the length of the one below it (rounding up), until the last
+// level holds just the product of everything, or the next level would have products of more than
+// max_bits bits:
+//
+inline void build_product_tree(std::vector<std::vector<cpp_int> >& tree, std::size_t max_bits = ~static_cast<std::size_t>(0u))
+{
+   while (tree.back().size() > 1)
+   {
+      const std::vector<cpp_int>& lower = tree.back();
+      std::size_t                 bits  = 0;
+      for (std::size_t i = 0; i < lower.size(); ++i)
+         bits = (std::max)(bits, static_cast<std::size_t>(msb(lower[i]) + 1));
+      if (2 * bits > max_bits)
+         break;
+      std::vector<cpp_int> upper((lower.size() + 1) / 2);
+      for (std::size_t i = 0; i < upper.size(); ++i)
+      {
+         if (2 * i + 1 < lower.size())
+            upper[i] = lower[2 * i] * lower[2 * i + 1];
+         else
+            upper[i] = lower[2 * i];
+      }
+      tree.push_back(upper);
+   }
+}
+
+} // namespace detail
+
+class trial_division
+{
+ public:
+   //
+   // Divides by all the primes <= bound:
+   //
+   explicit trial_division(boost::uint32_t bound = 65536) : m_bound(bound)
+   {
+      std::vector<bool> composite(static_cast<std::size_t>(bound) + 1);
+      for (boost::uint64_t i = 2; i <= bound; ++i)
+      {
+         if (composite[static_cast<std::size_t>(i)])
+            continue;
+         m_primes.push_back(static_cast<boost::uint32_t>(i));
+         for (boost::uint64_t j = i * i; j <= bound; j += i)
+            composite[static_cast<std::size_t>(j)] = true;
+      }
+      //
+      // Group the primes into leaves, each the product of as many consecutive primes as fit in a limb:
+      //
+      m_tree.push_back(std::vector<cpp_int>());
+      std::size_t i = 0;
+      while (i < m_primes.size())
+      {
+         limb_type product = m_primes[i];
+         m_leaf_first.push_back(i);
+         for (++i; (i < m_primes.size()) && (product <= (~static_cast<limb_type>(0u)) / m_primes[i]); ++i)
+            product *= m_primes[i];
+         m_tree.back().push_back(cpp_int(product));
+      }
+      m_leaf_first.push_back(m_primes.size());
+      if (m_primes.empty())
+         m_tree.back().push_back(cpp_int(1));
+      detail::build_product_tree(m_tree);
+   }
+
+   boost::uint32_t                     bound() const { return m_bound; }
+   const std::vector<boost::uint32_t>& primes() const { return m_primes; }
+   //
+   // The product of all the primes:
+   //
+   const cpp_int& primorial() const { return m_tree.back()[0]; }
+   //
+   // The smallest prime <= bound which divides n (which may be n itself), or 0 if there is none:
+   //
+   template <class Integer>
+   boost::uint32_t smallest_factor(const Integer& n) const
+   {
+      cpp_int r(n);
+      if (r < 0)
+         r = -r;
+      if (m_primes.empty())
+         return 0;
+      if (r == 0)
+         return 2;
+      return find_factor(r, static_cast<unsigned>(m_tree.size() - 1), 0);
+   }
+   template <class Integer>
+   bool has_small_factor(const Integer& n) const
+   {
+      return smallest_factor(n) != 0;
+   }
+   //
+   // Writes has_small_factor(n) for each n in [first, last) to out, in order, returning the end of
+   // the output:
+   //
+   template <class Iterator, class OutputIterator>
+   OutputIterator has_small_factor_batch(Iterator first, Iterator last, OutputIterator out) const
+   {
+      std::vector<std::vector<cpp_int> > tree(1);
+      std::vector<unsigned char>          zero;
+      for (; first != last; ++first)
+      {
+         cpp_int n(*first);
+         if (n < 0)
+            n = -n;
+         // 0 is divisible by everything, but would make the whole product zero:
+         zero.push_back(n == 0);
+         tree[0].push_back(n == 0 ? cpp_int(1) : n);
+      }
+      if (tree[0].empty())
+         return out;
+      //
+      // There's no point in products of the candidates larger than the product of the primes, so
+      // the tree may have several roots, and we reduce the product of the primes modulo each of
+      // them, and then modulo each node below:
+      //
+      detail::build_product_tree(tree, msb(primorial()) + 1);
+      std::vector<cpp_int> remainders(tree.back().size(), primorial());
+      for (std::size_t level = tree.size(); level-- > 0;)
+      {
+         const std::vector<cpp_int>& nodes = tree[level];
+         std::vector<cpp_int>        next(nodes.size());
+         for (std::size_t i = 0; i < nodes.size(); ++i)
+         {
+            const cpp_int& r = remainders[level + 1 == tree.size() ? i : i / 2];
+            if (r >= nodes[i])
+               next[i] = r % nodes[i];
+            else
+               next[i] = r;
+         }
+         remainders.swap(next);
+      }
+      for (std::size_t i = 0; i < remainders.size(); ++i)
+         *out++ = zero[i] ? !m_primes.empty() : gcd(remainders[i], tree[0][i]) != 1;
+      return out;
+   }
+   template <class Integer>
+   std::vector<bool> has_small_factor_batch(const std::vector<Integer>& values) const
+   {
+      std::vector<bool> result;
+      result.reserve(values.size());
+      has_small_factor_batch(values.begin(), values.end(), std::back_inserter(result));
+      return result;
+   }
+
+ private:
+   boost::uint32_t find_factor(const cpp_int& r, unsigned level, std::size_t index) const
+   {
+      const cpp_int& m = m_tree[level][index];
+      cpp_int        reduced;
+      const cpp_int* pr = &r;
+      if (r >= m)
+      {
+         reduced = r % m;
+         if (reduced == 0)
+            return m_primes[m_leaf_first[index << level]]; // Divisible by every prime here.
+         pr = &reduced;
+      }
+      if ((level == 0) || (msb(*pr) < BOOST_MP_TRIAL_DIVISION_LEAF_BITS))
+      {
+         //
+         // Once the remainder is small it's cheaper to reduce it by each leaf in turn, with a
+         // single limb divisor, than to carry on down the tree:
+         //
+         std::size_t first = index << level, last = (index + 1) << level;
+         if (last > m_tree[0].size())
+            last = m_tree[0].size();
+         for (std::size_t leaf = first; leaf < last; ++leaf)
+         {
+            limb_type x = level ? integer_modulus(*pr, m_tree[0][leaf].convert_to<limb_type>()) : pr->convert_to<limb_type>();
+            for (std::size_t i = m_leaf_first[leaf]; i < m_leaf_first[leaf + 1]; ++i)
+            {
+               if (x % m_primes[i] == 0)
+                  return m_primes[i];
+            }
+         }
+         return 0;
+      }
+      if (boost::uint32_t p = find_factor(*pr, level - 1, 2 * index))
+         return p;
+      if (2 * index + 1 < m_tree[level - 1].size())
+         return find_factor(*pr, level - 1, 2 * index + 1);
+      return 0;
+   }
+
+   boost::uint32_t                     m_bound;
+   std::vector<boost::uint32_t>        m_primes;
+   std::vector<std::size_t>            m_leaf_first; // The index of the first prime in each leaf.
+   std::vector<std::vector<cpp_int> >  m_tree;
+};
+
+}} // namespace boost::multiprecision
+
+#endif
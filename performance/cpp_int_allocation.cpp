@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Counts the calls to operator new made by the integer operations of performance_test for
+// cpp_int, cpp_int_pooled, and cpp_int_arena within an mp_arena, and times them.
+//
+
+#define BOOST_CHRONO_HEADER_ONLY
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random.hpp>
+#include <boost/chrono.hpp>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <vector>
+
+static unsigned long long allocation_count = 0;
+
+void* operator new(std::size_t n)
+{
+   ++allocation_count;
+   if (void* p = std::malloc(n ? n : 1))
+      return p;
+   throw std::bad_alloc();
+}
+void operator delete(void* p) BOOST_NOEXCEPT
+{
+   std::free(p);
+}
+#ifdef __cpp_sized_deallocation
+void operator delete(void* p, std::size_t) BOOST_NOEXCEPT
+{
+   std::free(p);
+}
+#endif
+
+template <class Clock>
+struct stopwatch
+{
+   typedef typename Clock::duration duration;
+   stopwatch()
+   {
+      m_start = Clock::now();
+   }
+   duration elapsed()
+   {
+      return Clock::now() - m_start;
+   }
+   void reset()
+   {
+      m_start = Clock::now();
+   }
+
+ private:
+   typename Clock::time_point m_start;
+};
+
+boost::random::mt19937 gen;
+
+template <class T>
+T random_value(unsigned bits)
+{
+   T result;
+   for (unsigned i = 0; i < bits; i += 32)
+   {
+      result <<= 32;
+      result |= gen();
+   }
+   return result;
+}
+
+template <class T>
+struct tester
+{
+   tester(unsigned bits)
+   {
+      gen.seed(bits);
+      a.assign(500, T(0));
+      for (unsigned i = 0; i < 500; ++i)
+      {
+         b.push_back(random_value<T>(bits));
+         c.push_back(random_value<T>(bits / 2) + 1);
+      }
+   }
+   template <class F>
+   void run(const char* name, F f, unsigned repeats)
+   {
+      allocation_count = 0;
+      stopwatch<boost::chrono::high_resolution_clock> w;
+      for (unsigned i = 0; i < repeats; ++i)
+         for (unsigned j = 0; j < b.size(); ++j)
+            f(a[j], b[j], c[j]);
+      double t = boost::chrono::duration_cast<boost::chrono::duration<double> >(w.elapsed()).count();
+      std::cout << std::setw(12) << name << std::setw(14) << allocation_count << std::setw(14) << std::setprecision(4) << t << std::endl;
+   }
+   std::vector<T> a, b, c;
+};
+
+template <class T>
+struct add
+{
+   void operator()(T& r, const T& x, const T& y) const { r = x + y; }
+};
+template <class T>
+struct multiply
+{
+   void operator()(T& r, const T& x, const T& y) const { r = x * y; }
+};
+template <class T>
+struct divide
+{
+   void operator()(T& r, const T& x, const T& y) const { r = x / y; }
+};
+template <class T>
+struct modulus
+{
+   void operator()(T& r, const T& x, const T& y) const { r = x % y; }
+};
+template <class T>
+struct left_shift
+{
+   void operator()(T& r, const T& x, const T&) const { r = x << 77; }
+};
+template <class T>
+struct gcd_op
+{
+   void operator()(T& r, const T& x, const T& y) const { r = gcd(x, y); }
+};
+template <class T>
+struct powm_op
+{
+   void operator()(T& r, const T& x, const T& y) const { r = powm(x, 65537, y | 1); }
+};
+template <class T>
+struct str_op
+{
+   void operator()(T& r, const T& x, const T&) const { r = T(x.str()); }
+};
+template <class T>
+struct expression
+{
+   void operator()(T& r, const T& x, const T& y) const { r = (x * y + x) / (y + 1) - x % y; }
+};
+
+template <class T>
+void test(const char* type, unsigned bits)
+{
+   std::cout << type << " with " << bits << " bits:\n"
+             << std::setw(12) << "operation" << std::setw(14) << "allocations" << std::setw(14) << "time (s)" << std::endl;
+   tester<T> t(bits);
+   t.run("+", add<T>(), 1000);
+   t.run("*", multiply<T>(), 100);
+   t.run("/", divide<T>(), 100);
+   t.run("%", modulus<T>(), 100);
+   t.run("<<", left_shift<T>(), 1000);
+   t.run("gcd", gcd_op<T>(), 10);
+   t.run("powm", powm_op<T>(), 1);
+   t.run("str", str_op<T>(), 10);
+   t.run("expression", expression<T>(), 100);
+   std::cout << std::endl;
+}
+
+int main()
+{
+   static const unsigned bits[] = {128, 256, 512, 1024, 4096};
+   for (unsigned i = 0; i < sizeof(bits) / sizeof(bits[0]); ++i)
+   {
+      test<boost::multiprecision::cpp_int>("cpp_int", bits[i]);
+      test<boost::multiprecision::cpp_int_pooled>("cpp_int_pooled", bits[i]);
+      boost::multiprecision::mp_arena arena;
+      test<boost::multiprecision::cpp_int_arena>("cpp_int_arena", bits[i]);
+   }
+   return 0;
+}
@@ -0,0 +1,208 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compares arbitrary precision cpp_int's with internal limb caches of various sizes, on a
+// workload of mostly 2-8 limb values with the occasional much larger one: for each cache size
+// we show the size of the object, and the calls to operator new made by, and time taken for,
+// building, copying, sorting and doing arithmetic on a vector of such values.  The arithmetic
+// assigns to existing values, so only allocates for temporaries, or when a result outgrows its
+// storage.
+//
+
+#define BOOST_CHRONO_HEADER_ONLY
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random.hpp>
+#include <boost/chrono.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <vector>
+
+static unsigned long long allocation_count = 0;
+
+void* operator new(std::size_t n)
+{
+   ++allocation_count;
+   if (void* p = std::malloc(n ? n : 1))
+      return p;
+   throw std::bad_alloc();
+}
+void operator delete(void* p) BOOST_NOEXCEPT
+{
+   std::free(p);
+}
+#ifdef __cpp_sized_deallocation
+void operator delete(void* p, std::size_t) BOOST_NOEXCEPT
+{
+   std::free(p);
+}
+#endif
+
+template <class Clock>
+struct stopwatch
+{
+   typedef typename Clock::duration duration;
+   stopwatch()
+   {
+      m_start = Clock::now();
+   }
+   duration elapsed()
+   {
+      return Clock::now() - m_start;
+   }
+   void reset()
+   {
+      m_start = Clock::now();
+   }
+
+ private:
+   typename Clock::time_point m_start;
+};
+
+using boost::multiprecision::cpp_int;
+
+static const unsigned value_count   = 10000;
+static const unsigned outlier_bits  = 8192;
+static const unsigned outlier_ratio = 100;
+
+//
+// Values of 2 to 8 limbs, with one in every outlier_ratio being outlier_bits long:
+//
+std::vector<cpp_int> make_values()
+{
+   boost::random::mt19937                    gen;
+   boost::random::uniform_int_distribution<> limbs(2, 8);
+   std::vector<cpp_int>                      result;
+   for (unsigned i = 0; i < value_count; ++i)
+   {
+      unsigned bits = i % outlier_ratio ? limbs(gen) * 64 - 10 : outlier_bits;
+      cpp_int  v;
+      for (unsigned j = 0; j < bits; j += 32)
+      {
+         v <<= 32;
+         v |= gen();
+      }
+      result.push_back(v);
+   }
+   return result;
+}
+
+template <class T>
+struct tester
+{
+   tester(const std::vector<cpp_int>& v) : source(v) {}
+   template <class F>
+   void run(const char* name, F f, unsigned repeats)
+   {
+      allocation_count = 0;
+      stopwatch<boost::chrono::high_resolution_clock> w;
+      for (unsigned i = 0; i < repeats; ++i)
+         f(*this);
+      double t = boost::chrono::duration_cast<boost::chrono::duration<double> >(w.elapsed()).count();
+      std::cout << std::setw(12) << name << std::setw(14) << allocation_count / repeats << std::setw(14) << std::setprecision(4) << t << std::endl;
+   }
+   const std::vector<cpp_int>& source;
+   std::vector<T>              values, result;
+};
+
+template <class T>
+struct construct
+{
+   void operator()(tester<T>& t) const
+   {
+      std::vector<T>(t.source.begin(), t.source.end()).swap(t.values);
+   }
+};
+template <class T>
+struct copy
+{
+   void operator()(tester<T>& t) const
+   {
+      std::vector<T>(t.values).swap(t.result);
+   }
+};
+template <class T>
+struct sort
+{
+   void operator()(tester<T>& t) const
+   {
+      t.result = t.values;
+      std::sort(t.result.begin(), t.result.end());
+   }
+};
+template <class T>
+struct add
+{
+   void operator()(tester<T>& t) const
+   {
+      for (unsigned i = 1; i < t.values.size(); ++i)
+         t.result[i] = t.values[i] + t.values[i - 1];
+   }
+};
+template <class T>
+struct multiply
+{
+   void operator()(tester<T>& t) const
+   {
+      for (unsigned i = 1; i < t.values.size(); ++i)
+         t.result[i] = t.values[i] * t.values[i - 1];
+   }
+};
+template <class T>
+struct modulus
+{
+   void operator()(tester<T>& t) const
+   {
+      for (unsigned i = 1; i < t.values.size(); ++i)
+         t.result[i] = t.values[i] % (t.values[i - 1] | 1);
+   }
+};
+template <class T>
+struct expression
+{
+   void operator()(tester<T>& t) const
+   {
+      for (unsigned i = 1; i < t.values.size(); ++i)
+      {
+         const T& x = t.values[i];
+         const T& y = t.values[i - 1];
+         t.result[i] = (x * y + x) / (y + 1) - x % (y | 1);
+      }
+   }
+};
+
+template <class T>
+void test(const char* type, const std::vector<cpp_int>& values)
+{
+   std::cout << type << ", sizeof = " << sizeof(T) << ":\n"
+             << std::setw(12) << "operation" << std::setw(14) << "allocations" << std::setw(14) << "time (s)" << std::endl;
+   tester<T> t(values);
+   t.run("construct", construct<T>(), 20);
+   t.run("copy", copy<T>(), 20);
+   t.run("sort", sort<T>(), 5);
+   t.run("+", add<T>(), 50);
+   t.run("*", multiply<T>(), 20);
+   t.run("%", modulus<T>(), 20);
+   t.run("expression", expression<T>(), 5);
+   std::cout << std::endl;
+}
+
+int main()
+{
+   using boost::multiprecision::number;
+   using boost::multiprecision::cpp_int_backend;
+
+   std::vector<cpp_int> values = make_values();
+   test<cpp_int>("cpp_int", values);
+   test<number<cpp_int_backend<128> > >("cpp_int_backend<128>", values);
+   test<number<cpp_int_backend<256> > >("cpp_int_backend<256>", values);
+   test<number<cpp_int_backend<512> > >("cpp_int_backend<512>", values);
+   test<number<cpp_int_backend<1024> > >("cpp_int_backend<1024>", values);
+   return 0;
+}
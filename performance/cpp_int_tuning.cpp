@@ -0,0 +1,210 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Measures the crossover points between the cpp_int multiplication, division, gcd and decimal
+// conversion algorithms on this machine, and writes them out as a header of BOOST_MP_XXX_CUTOFF
+// macros, which should be included (or the values otherwise defined) before <boost/multiprecision/cpp_int.hpp>.
+// The same values may instead be applied at runtime with set_cpp_int_tuning().
+//
+// Usage: cpp_int_tuning [output-file]
+//
+// Each crossover is found by timing one level of the faster algorithm (with everything
+// below it using the slower one) against the slower algorithm alone, at increasing sizes,
+// and taking the first size from which the faster algorithm wins consistently.
+//
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random.hpp>
+#include <boost/chrono.hpp>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+template <class Clock>
+struct stopwatch
+{
+   typedef typename Clock::duration duration;
+   stopwatch()
+   {
+      m_start = Clock::now();
+   }
+   duration elapsed()
+   {
+      return Clock::now() - m_start;
+   }
+   void reset()
+   {
+      m_start = Clock::now();
+   }
+
+ private:
+   typename Clock::time_point m_start;
+};
+
+using boost::multiprecision::cpp_int;
+using boost::multiprecision::cpp_int_tuning;
+
+boost::random::mt19937 gen;
+
+cpp_int random_value(unsigned limbs)
+{
+   cpp_int result;
+   unsigned bits = limbs * sizeof(boost::multiprecision::limb_type) * CHAR_BIT;
+   for (unsigned i = 0; i < bits; i += 32)
+   {
+      result <<= 32;
+      result |= gen();
+   }
+   return result;
+}
+enum operation
+{
+   multiply,
+   square,
+   divide,
+   greatest_common_divisor,
+   decimal_string
+};
+
+cpp_int apply(operation op, const cpp_int& a, const cpp_int& b)
+{
+   switch (op)
+   {
+   case square:
+      return a * a;
+   case divide:
+      return a / b;
+   case greatest_common_divisor:
+      return gcd(a, b);
+   case decimal_string:
+      return a.str().size();
+   default:
+      return a * b;
+   }
+}
+//
+// Time in seconds for a single product a * b, square a * a, gcd(a, b), conversion of a to decimal,
+// or quotient of a 2n-limb value by an n-limb one, using tuning t, we take the best of several runs to filter out interruptions:
+//
+double time_operation(const cpp_int_tuning& t, unsigned limbs, operation op)
+{
+   boost::multiprecision::set_cpp_int_tuning(t);
+   cpp_int  a = random_value(op == divide ? 2 * limbs : limbs);
+   cpp_int  b = op == square ? a : random_value(limbs);
+   cpp_int  r;
+   unsigned reps = 1;
+   double   best = (std::numeric_limits<double>::max)();
+   stopwatch<boost::chrono::high_resolution_clock> w;
+   //
+   // Find a repetition count that takes a measurable time:
+   //
+   do
+   {
+      reps *= 2;
+      w.reset();
+      for (unsigned i = 0; i < reps; ++i)
+         r = apply(op, a, b);
+   } while (boost::chrono::duration_cast<boost::chrono::duration<double> >(w.elapsed()).count() < 0.002);
+
+   for (unsigned trial = 0; trial < 5; ++trial)
+   {
+      w.reset();
+      for (unsigned i = 0; i < reps; ++i)
+         r = apply(op, a, b);
+      double d = boost::chrono::duration_cast<boost::chrono::duration<double> >(w.elapsed()).count() / reps;
+      if (d < best)
+         best = d;
+   }
+   return best;
+}
+//
+// Returns the first size from which setting member "cutoff" of t to that size (so the
+// new algorithm is used once at the top level) is faster than setting it one higher
+// (so it isn't used at all), for 3 sizes in a row:
+//
+unsigned find_cutoff(cpp_int_tuning t, unsigned cpp_int_tuning::*cutoff, const char* name, unsigned first, unsigned last, operation op = multiply)
+{
+   std::vector<unsigned> sizes;
+   for (unsigned n = first; n <= last; n += (std::max)(1u, n / 16))
+      sizes.push_back(n);
+
+   unsigned wins = 0;
+   for (unsigned i = 0; i < sizes.size(); ++i)
+   {
+      unsigned n = sizes[i];
+      t.*cutoff  = n + 1;
+      double old_time = time_operation(t, n, op);
+      t.*cutoff  = n;
+      double new_time = time_operation(t, n, op);
+      std::cerr << name << ": " << n << " limbs, " << old_time * 1e6 << "us vs " << new_time * 1e6 << "us" << std::endl;
+      if (new_time < old_time)
+      {
+         if (++wins == 3)
+            return sizes[i - 2];
+      }
+      else
+         wins = 0;
+   }
+   std::cerr << name << ": no crossover found below " << last << " limbs." << std::endl;
+   return last;
+}
+
+int main(int argc, char* argv[])
+{
+   using namespace boost::multiprecision;
+
+   const cpp_int_tuning defaults = default_cpp_int_tuning();
+   const unsigned       never    = (std::numeric_limits<unsigned>::max)() / 2;
+
+   cpp_int_tuning t      = defaults;
+   t.toom3_cutoff        = never;
+   t.toom4_cutoff        = never;
+   t.ntt_cutoff          = never;
+   t.karatsuba_square_cutoff = never;
+   t.burnikel_ziegler_cutoff = never;
+   t.karatsuba_cutoff    = find_cutoff(t, &cpp_int_tuning::karatsuba_cutoff, "karatsuba_cutoff", 8, 256);
+   t.karatsuba_square_cutoff = find_cutoff(t, &cpp_int_tuning::karatsuba_square_cutoff, "karatsuba_square_cutoff", t.karatsuba_cutoff, 512, square);
+   t.toom3_cutoff        = find_cutoff(t, &cpp_int_tuning::toom3_cutoff, "toom3_cutoff", 2 * t.karatsuba_cutoff, 1024);
+   t.toom4_cutoff        = find_cutoff(t, &cpp_int_tuning::toom4_cutoff, "toom4_cutoff", t.toom3_cutoff, 2048);
+   t.ntt_cutoff          = find_cutoff(t, &cpp_int_tuning::ntt_cutoff, "ntt_cutoff", t.toom4_cutoff, 16384);
+   t.burnikel_ziegler_cutoff = find_cutoff(t, &cpp_int_tuning::burnikel_ziegler_cutoff, "burnikel_ziegler_cutoff", t.karatsuba_cutoff, 1024, divide);
+   t.hgcd_cutoff         = find_cutoff(t, &cpp_int_tuning::hgcd_cutoff, "hgcd_cutoff", 64, 4096, greatest_common_divisor);
+   t.decimal_conversion_cutoff = find_cutoff(t, &cpp_int_tuning::decimal_conversion_cutoff, "decimal_conversion_cutoff", 16, 2048, decimal_string);
+   set_cpp_int_tuning(defaults);
+
+   std::ofstream file;
+   if (argc > 1)
+   {
+      file.open(argv[1]);
+      if (!file)
+      {
+         std::cerr << "Unable to open output file " << argv[1] << std::endl;
+         return 1;
+      }
+   }
+   std::ostream& os = argc > 1 ? file : std::cout;
+
+   os << "//\n"
+         "// cpp_int multiplication, division, gcd and decimal conversion cutoffs for this machine, generated by performance/cpp_int_tuning.cpp.\n"
+         "// Include this before <boost/multiprecision/cpp_int.hpp>, or apply the same values at runtime with:\n"
+         "//\n"
+         "//    boost::multiprecision::cpp_int_tuning t = { "
+      << t.karatsuba_cutoff << ", " << t.karatsuba_square_cutoff << ", " << t.toom3_cutoff << ", " << t.toom4_cutoff << ", " << t.ntt_cutoff << ", " << t.burnikel_ziegler_cutoff << ", " << t.hgcd_cutoff << ", " << t.decimal_conversion_cutoff << " };\n"
+         "//    boost::multiprecision::set_cpp_int_tuning(t);\n"
+         "//\n"
+         "#ifndef BOOST_MP_CPP_INT_TUNED_HPP\n"
+         "#define BOOST_MP_CPP_INT_TUNED_HPP\n\n"
+         "#define BOOST_MP_KARATSUBA_CUTOFF " << t.karatsuba_cutoff << "\n"
+         "#define BOOST_MP_KARATSUBA_SQUARE_CUTOFF " << t.karatsuba_square_cutoff << "\n"
+         "#define BOOST_MP_TOOM3_CUTOFF " << t.toom3_cutoff << "\n"
+         "#define BOOST_MP_TOOM4_CUTOFF " << t.toom4_cutoff << "\n"
+         "#define BOOST_MP_NTT_CUTOFF " << t.ntt_cutoff << "\n"
+         "#define BOOST_MP_BURNIKEL_ZIEGLER_CUTOFF " << t.burnikel_ziegler_cutoff << "\n"
+         "#define BOOST_MP_HGCD_CUTOFF " << t.hgcd_cutoff << "\n"
+         "#define BOOST_MP_DECIMAL_CONVERSION_CUTOFF " << t.decimal_conversion_cutoff << "\n\n"
+         "#endif\n";
+   return 0;
+}
@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Times factorial, binomial and primorial against the obvious loops, which multiply (and for the
+// binomial coefficient, divide) a growing value by one word at a time.
+//
+
+#define BOOST_CHRONO_HEADER_ONLY
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/chrono.hpp>
+#include <iomanip>
+#include <iostream>
+
+using namespace boost::multiprecision;
+
+template <class Clock>
+struct stopwatch
+{
+   typedef typename Clock::duration duration;
+   stopwatch()
+   {
+      m_start = Clock::now();
+   }
+   duration elapsed()
+   {
+      return Clock::now() - m_start;
+   }
+   void reset()
+   {
+      m_start = Clock::now();
+   }
+
+ private:
+   typename Clock::time_point m_start;
+};
+
+cpp_int loop_factorial(unsigned n)
+{
+   cpp_int result(1);
+   for (unsigned i = 2; i <= n; ++i)
+      result *= i;
+   return result;
+}
+
+cpp_int loop_binomial(unsigned n)
+{
+   cpp_int result(1);
+   for (unsigned i = 0; i < n / 2; ++i)
+   {
+      result *= n - i;
+      result /= i + 1;
+   }
+   return result;
+}
+
+cpp_int loop_primorial(unsigned n)
+{
+   cpp_int result(1);
+   for (unsigned i = 2; i <= n; ++i)
+   {
+      bool prime = true;
+      for (unsigned d = 2; prime && (d * d <= i); ++d)
+         prime = i % d != 0;
+      if (prime)
+         result *= i;
+   }
+   return result;
+}
+
+cpp_int fast_factorial(unsigned n)
+{
+   return factorial<cpp_int>(n);
+}
+
+cpp_int fast_binomial(unsigned n)
+{
+   return binomial<cpp_int>(n, n / 2);
+}
+
+cpp_int fast_primorial(unsigned n)
+{
+   return primorial<cpp_int>(n);
+}
+
+template <class F>
+double time(F f, unsigned n, cpp_int& result)
+{
+   stopwatch<boost::chrono::high_resolution_clock> w;
+   result = f(n);
+   return boost::chrono::duration_cast<boost::chrono::duration<double> >(w.elapsed()).count();
+}
+
+int main()
+{
+   std::cout << std::setw(8) << "n" << std::setw(12) << "n!" << std::setw(12) << "loop"
+             << std::setw(12) << "(n, n/2)" << std::setw(12) << "loop" << std::setw(12) << "n#" << std::setw(12) << "loop" << std::endl;
+   static const unsigned n[] = {1000, 10000, 100000, 300000};
+   for (unsigned i = 0; i < sizeof(n) / sizeof(n[0]); ++i)
+   {
+      cpp_int a, b;
+      std::cout << std::setw(8) << n[i] << std::setprecision(4);
+      std::cout << std::setw(12) << time(fast_factorial, n[i], a) << std::setw(12) << time(loop_factorial, n[i], b);
+      if (a != b)
+         std::cout << "factorial mismatch!";
+      std::cout << std::setw(12) << time(fast_binomial, n[i], a) << std::setw(12) << time(loop_binomial, n[i], b);
+      if (a != b)
+         std::cout << "binomial mismatch!";
+      std::cout << std::setw(12) << time(fast_primorial, n[i], a) << std::setw(12) << time(loop_primorial, n[i], b);
+      if (a != b)
+         std::cout << "primorial mismatch!";
+      std::cout << std::endl;
+   }
+   return 0;
+}
@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Times miller_rabin_test_batch on a batch of random odd 2048-bit candidates, and on a single
+// 2048-bit prime, for increasing numbers of threads, against calling miller_rabin_test in a loop.
+//
+
+#define BOOST_CHRONO_HEADER_ONLY
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/miller_rabin_batch.hpp>
+#include <boost/multiprecision/prime_generation.hpp>
+#include <boost/chrono.hpp>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+using namespace boost::multiprecision;
+
+template <class Clock>
+struct stopwatch
+{
+   typedef typename Clock::duration duration;
+   stopwatch()
+   {
+      m_start = Clock::now();
+   }
+   duration elapsed()
+   {
+      return Clock::now() - m_start;
+   }
+   void reset()
+   {
+      m_start = Clock::now();
+   }
+
+ private:
+   typename Clock::time_point m_start;
+};
+
+double seconds(stopwatch<boost::chrono::high_resolution_clock>& w)
+{
+   return boost::chrono::duration_cast<boost::chrono::duration<double> >(w.elapsed()).count();
+}
+
+int main()
+{
+   boost::random::mt19937                                                        gen;
+   boost::random::independent_bits_engine<boost::random::mt19937, 2048, cpp_int> gen2048;
+   std::vector<cpp_int>                                                          values;
+   for (unsigned i = 0; i < 1000; ++i)
+      values.push_back(gen2048() | 1);
+   std::vector<cpp_int> prime(1, random_prime<cpp_int>(2048, 0, gen));
+
+   stopwatch<boost::chrono::high_resolution_clock> w;
+   unsigned                                        count = 0;
+   for (unsigned i = 0; i < values.size(); ++i)
+      count += miller_rabin_test(values[i], 25, gen);
+   double serial = seconds(w);
+   w.reset();
+   miller_rabin_test(prime[0], 25, gen);
+   double serial_prime = seconds(w);
+
+   std::cout << count << " probable primes among " << values.size() << " 2048-bit candidates.\n\n"
+             << std::setw(10) << "threads" << std::setw(16) << "batch (s)" << std::setw(16) << "prime (s)" << std::endl;
+   std::cout << std::setw(10) << "loop" << std::setprecision(4) << std::setw(16) << serial << std::setw(16) << serial_prime << std::endl;
+   unsigned hardware = std::thread::hardware_concurrency();
+   for (unsigned threads = 1; threads <= (hardware > 1 ? hardware : 1); threads *= 2)
+   {
+      w.reset();
+      miller_rabin_test_batch(values, 25, threads);
+      double batch = seconds(w);
+      w.reset();
+      miller_rabin_test_batch(prime, 25, threads);
+      std::cout << std::setw(10) << threads << std::setw(16) << batch << std::setw(16) << seconds(w) << std::endl;
+   }
+   return 0;
+}
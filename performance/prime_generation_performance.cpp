@@ -0,0 +1,103 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Times random_prime and random_safe_prime against the obvious search which tests random odd
+// values (or successive odd values) with miller_rabin_test until one passes.
+//
+
+#define BOOST_CHRONO_HEADER_ONLY
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/prime_generation.hpp>
+#include <boost/chrono.hpp>
+#include <iomanip>
+#include <iostream>
+
+using namespace boost::multiprecision;
+
+template <class Clock>
+struct stopwatch
+{
+   typedef typename Clock::duration duration;
+   stopwatch()
+   {
+      m_start = Clock::now();
+   }
+   duration elapsed()
+   {
+      return Clock::now() - m_start;
+   }
+   void reset()
+   {
+      m_start = Clock::now();
+   }
+
+ private:
+   typename Clock::time_point m_start;
+};
+
+boost::random::mt19937 gen, gen2;
+
+cpp_int random_odd_value(unsigned bits)
+{
+   boost::random::uniform_int_distribution<cpp_int> dist(cpp_int(1) << (bits - 1), (cpp_int(1) << bits) - 1);
+   return dist(gen) | 1;
+}
+
+cpp_int search_prime(unsigned bits)
+{
+   cpp_int n = random_odd_value(bits);
+   while (!miller_rabin_test(n, 25, gen2))
+      n += 2;
+   return n;
+}
+
+cpp_int search_safe_prime(unsigned bits)
+{
+   while (true)
+   {
+      cpp_int n = random_odd_value(bits);
+      if (miller_rabin_test(n, 25, gen2) && miller_rabin_test(n >> 1, 25, gen2))
+         return n;
+   }
+}
+
+template <class F>
+double time(F f, unsigned bits, unsigned count)
+{
+   stopwatch<boost::chrono::high_resolution_clock> w;
+   for (unsigned i = 0; i < count; ++i)
+      f(bits);
+   return boost::chrono::duration_cast<boost::chrono::duration<double> >(w.elapsed()).count() / count;
+}
+
+cpp_int sieved_prime(unsigned bits)
+{
+   return random_prime<cpp_int>(bits, 25, gen);
+}
+
+cpp_int sieved_safe_prime(unsigned bits)
+{
+   return random_safe_prime<cpp_int>(bits, 25, gen);
+}
+
+int main()
+{
+   std::cout << std::setw(6) << "bits" << std::setw(16) << "miller_rabin" << std::setw(16) << "random_prime"
+             << std::setw(16) << "miller_rabin" << std::setw(20) << "random_safe_prime" << std::endl;
+   static const unsigned bits[] = {128, 256, 512, 1024};
+   for (unsigned i = 0; i < sizeof(bits) / sizeof(bits[0]); ++i)
+   {
+      std::cout << std::setw(6) << bits[i] << std::setprecision(4)
+                << std::setw(16) << time(search_prime, bits[i], 20)
+                << std::setw(16) << time(sieved_prime, bits[i], 20);
+      if (bits[i] <= 256)
+         std::cout << std::setw(16) << time(search_safe_prime, bits[i], 2)
+                   << std::setw(20) << time(sieved_safe_prime, bits[i], 2);
+      std::cout << std::endl;
+   }
+   return 0;
+}
@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Times trial division by the primes below 100000 using trial_division, against dividing by each
+// prime in turn, and against a single powm of the same size (the cost of one Fermat or
+// Miller-Rabin trial).  Then times has_small_factor_batch against has_small_factor for each value,
+// for values with no small factors, where all of the primes have to be tried.
+//
+
+#define BOOST_CHRONO_HEADER_ONLY
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/trial_division.hpp>
+#include <boost/chrono.hpp>
+#include <boost/random.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace boost::multiprecision;
+
+template <class Clock>
+struct stopwatch
+{
+   typedef typename Clock::duration duration;
+   stopwatch()
+   {
+      m_start = Clock::now();
+   }
+   duration elapsed()
+   {
+      return Clock::now() - m_start;
+   }
+   void reset()
+   {
+      m_start = Clock::now();
+   }
+
+ private:
+   typename Clock::time_point m_start;
+};
+
+double seconds(stopwatch<boost::chrono::high_resolution_clock>& w)
+{
+   return boost::chrono::duration_cast<boost::chrono::duration<double> >(w.elapsed()).count();
+}
+
+unsigned naive_smallest_factor(const trial_division& td, const cpp_int& n)
+{
+   for (std::size_t i = 0; i < td.primes().size(); ++i)
+      if (integer_modulus(n, td.primes()[i]) == 0)
+         return td.primes()[i];
+   return 0;
+}
+
+int main()
+{
+   trial_division td(100000);
+   boost::random::independent_bits_engine<boost::random::mt19937, 8192, cpp_int> gen;
+
+   std::cout << std::setw(6) << "bits" << std::setw(16) << "trial_division" << std::setw(16) << "naive"
+             << std::setw(16) << "powm" << std::setw(16) << "batch" << std::setw(16) << "single" << std::endl;
+   static const unsigned bits[] = {512, 1024, 2048, 4096, 8192};
+   for (unsigned i = 0; i < sizeof(bits) / sizeof(bits[0]); ++i)
+   {
+      //
+      // Odd values with no factors below the bound:
+      //
+      std::vector<cpp_int> values;
+      while (values.size() < 100)
+      {
+         cpp_int n = (gen() >> (8192 - bits[i])) | 1;
+         if (!td.has_small_factor(n))
+            values.push_back(n);
+      }
+      unsigned                                        found = 0;
+      stopwatch<boost::chrono::high_resolution_clock> w;
+      for (unsigned j = 0; j < values.size(); ++j)
+         found += td.smallest_factor(values[j]);
+      double t_tree = seconds(w) / values.size();
+      w.reset();
+      for (unsigned j = 0; j < 10; ++j)
+         found += naive_smallest_factor(td, values[j]);
+      double t_naive = seconds(w) / 10;
+      w.reset();
+      cpp_int r = powm(cpp_int(2), values[0] - 1, values[0]);
+      double  t_powm = seconds(w);
+      w.reset();
+      std::vector<bool> batch = td.has_small_factor_batch(values);
+      double            t_batch = seconds(w) / values.size();
+      w.reset();
+      for (unsigned j = 0; j < values.size(); ++j)
+         found += td.has_small_factor(values[j]);
+      double t_single = seconds(w) / values.size();
+
+      std::cout << std::setw(6) << bits[i] << std::setprecision(4) << std::setw(16) << t_tree << std::setw(16) << t_naive
+                << std::setw(16) << t_powm << std::setw(16) << t_batch << std::setw(16) << t_single << std::endl;
+      if (found || (r == 0) || (std::count(batch.begin(), batch.end(), true) != 0))
+         std::cout << "Unexpected small factor!" << std::endl;
+   }
+   return 0;
+}
@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks jacobi against Euler's criterion, and baillie_psw_test against a sieve, known
+// pseudoprimes, and miller_rabin_test.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/miller_rabin.hpp>
+#include <vector>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+template <class I>
+void test_jacobi()
+{
+   for (int n = 1; n < 200; n += 2)
+   {
+      for (int a = -300; a < 300; ++a)
+      {
+         //
+         // For prime n, Euler's criterion, and otherwise the product over the factors of n:
+         //
+         int expected = 1, m = n;
+         for (int p = 3; m > 1; p += 2)
+         {
+            while (m % p == 0)
+            {
+               int r = ((a % p) + p) % p;
+               int e = r ? static_cast<int>(powm(r, (p - 1) / 2, p)) : 0;
+               expected *= e == 1 ? 1 : e == 0 ? 0 : -1;
+               m /= p;
+            }
+         }
+         if (std::numeric_limits<I>::is_signed || (a >= 0))
+            BOOST_CHECK_EQUAL(jacobi(I(a), I(n)), expected);
+      }
+   }
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(jacobi(I(3), I(4)), std::domain_error);
+   BOOST_CHECK_THROW(jacobi(I(3), I(0)), std::domain_error);
+#endif
+}
+
+template <class I>
+void test_small()
+{
+   static const unsigned limit = 200000;
+   std::vector<bool>     composite(limit);
+   composite[0] = composite[1] = true;
+   for (unsigned i = 2; i * i < limit; ++i)
+      if (!composite[i])
+         for (unsigned j = i * i; j < limit; j += i)
+            composite[j] = true;
+   for (unsigned i = 0; i < limit; ++i)
+      BOOST_CHECK_EQUAL(baillie_psw_test(I(i)), !composite[i]);
+}
+
+template <class I>
+void test_pseudoprimes()
+{
+   //
+   // Strong pseudoprimes to base 2, strong Lucas pseudoprimes, Carmichael numbers, and squares
+   // of primes, none of which are prime:
+   //
+   static const boost::uint64_t composites[] = {
+       2047u, 3277u, 4033u, 4681u, 8321u, 15841u, 29341u, 42799u, 49141u, 52633u, 65281u, 74665u,
+       5459u, 5777u, 10877u, 16109u, 18971u, 22499u, 24569u, 25199u, 40309u, 58519u, 75077u, 97439u,
+       561u, 1105u, 1729u, 2465u, 2821u, 6601u, 8911u, 41041u, 62745u, 63973u, 75361u, 101101u,
+       229u * 229u, 65521u * 65521u, static_cast<boost::uint64_t>(4294967291u) * 4294967291u,
+       3215031751u, 2152302898747u, 3474749660383u, 341550071728321u, 3825123056546413051u};
+   for (unsigned i = 0; i < sizeof(composites) / sizeof(composites[0]); ++i)
+      BOOST_CHECK(!baillie_psw_test(I(composites[i])));
+   static const boost::uint64_t primes[] = {
+       229u, 65521u, 4294967291u, 4294967311u, 2305843009213693951u, 18446744073709551557u};
+   for (unsigned i = 0; i < sizeof(primes) / sizeof(primes[0]); ++i)
+      BOOST_CHECK(baillie_psw_test(I(primes[i])));
+}
+
+void test_large()
+{
+   //
+   // Mersenne primes and composites, products of two large primes, and agreement with
+   // miller_rabin_test on random values:
+   //
+   static const unsigned exponents[] = {61, 89, 107, 127, 521, 607, 1279, 2203};
+   for (unsigned i = 0; i < sizeof(exponents) / sizeof(exponents[0]); ++i)
+   {
+      cpp_int m = (cpp_int(1) << exponents[i]) - 1;
+      BOOST_CHECK(baillie_psw_test(m));
+      BOOST_CHECK(!baillie_psw_test(m + 2));
+      BOOST_CHECK(!baillie_psw_test(m * m));
+      BOOST_CHECK(!baillie_psw_test(m * ((cpp_int(1) << 127) - 1)));
+   }
+   BOOST_CHECK(!baillie_psw_test((cpp_int(1) << 67) - 1));
+   BOOST_CHECK(!baillie_psw_test(cpp_int(-7)));
+
+   boost::random::mt19937                                                      gen2;
+   boost::random::independent_bits_engine<boost::random::mt19937, 512, cpp_int> gen512;
+   unsigned                                                                    primes = 0;
+   for (unsigned i = 0; i < 5000; ++i)
+   {
+      cpp_int n = gen512() | 1;
+      bool    p = baillie_psw_test(n);
+      BOOST_CHECK_EQUAL(p, miller_rabin_test(n, 25, gen2));
+      primes += p;
+   }
+   BOOST_CHECK(primes > 5);
+   //
+   // Fixed precision types, with the top bit set:
+   //
+   uint256_t p = uint256_t(cpp_int((cpp_int(1) << 256) - 189));
+   BOOST_CHECK(baillie_psw_test(p));
+   BOOST_CHECK(!baillie_psw_test(uint256_t(p - 2)));
+   int512_t q = (int512_t(1) << 511) - 187;
+   BOOST_CHECK(baillie_psw_test(q));
+}
+
+int main()
+{
+   test_jacobi<int>();
+   test_jacobi<boost::uint64_t>();
+   test_jacobi<cpp_int>();
+   test_jacobi<int128_t>();
+   test_small<boost::uint32_t>();
+   test_small<boost::int64_t>();
+   test_small<cpp_int>();
+   test_small<checked_uint128_t>();
+   test_pseudoprimes<boost::uint64_t>();
+   test_pseudoprimes<cpp_int>();
+   test_pseudoprimes<uint128_t>();
+   test_large();
+   return boost::report_errors();
+}
@@ -0,0 +1,309 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Round trip values through write_binary and read_binary, check the encoding is what's documented,
+// and that malformed data is rejected.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <iterator>
+#include <sstream>
+#include "test.hpp"
+
+boost::random::mt19937 gen;
+
+template <class T>
+std::vector<unsigned char> to_binary(const T& val)
+{
+   std::vector<unsigned char> result;
+   boost::multiprecision::write_binary(std::back_inserter(result), val);
+   return result;
+}
+
+template <class T>
+T from_binary(const std::vector<unsigned char>& data)
+{
+   T val;
+   BOOST_CHECK(boost::multiprecision::read_binary(data.begin(), data.end(), val) == data.end());
+   return val;
+}
+
+template <class T>
+void check_round_trip(const T& val)
+{
+   T result = from_binary<T>(to_binary(val));
+   BOOST_CHECK_EQUAL(result, val);
+   BOOST_CHECK_EQUAL(result.sign(), val.sign());
+}
+
+template <class T>
+bool is_negative_zero(const T& val)
+{
+   return (val == 0) && (boost::math::signbit(val) != 0);
+}
+
+template <class Int>
+void test_integer()
+{
+   unsigned count = std::numeric_limits<Int>::is_bounded ? std::numeric_limits<Int>::digits / 5 : 300;
+   Int      val   = 1;
+   for (unsigned i = 0; i < count; ++i)
+   {
+      check_round_trip(val);
+      if (std::numeric_limits<Int>::is_signed)
+         check_round_trip(Int(Int(0) - val));
+      val <<= 5;
+      val += gen() % 32;
+   }
+   check_round_trip(Int(0));
+   if (std::numeric_limits<Int>::is_bounded)
+      check_round_trip((std::numeric_limits<Int>::max)());
+}
+
+template <class Float>
+void test_float()
+{
+   Float val = 1;
+   for (unsigned i = 0; i < 200; ++i)
+   {
+      check_round_trip(val);
+      check_round_trip(Float(-val));
+      check_round_trip(Float(1 / val));
+      val *= Float(gen()) / Float(gen() + 1u);
+   }
+   check_round_trip(Float(0));
+   check_round_trip(Float(1) / 3);
+   check_round_trip((std::numeric_limits<Float>::max)());
+   check_round_trip((std::numeric_limits<Float>::min)());
+   check_round_trip(std::numeric_limits<Float>::epsilon());
+   check_round_trip(std::numeric_limits<Float>::infinity());
+   check_round_trip(Float(-std::numeric_limits<Float>::infinity()));
+   BOOST_CHECK((boost::math::isnan)(from_binary<Float>(to_binary(std::numeric_limits<Float>::quiet_NaN()))));
+}
+//
+// Reading data written at a different precision rounds as conversion between the types does:
+//
+template <class Narrow, class Wide>
+void test_float_precision_change()
+{
+   Wide val = 1;
+   for (unsigned i = 0; i < 200; ++i)
+   {
+      val *= Wide(gen()) / Wide(gen() + 1u);
+      Wide x = val / 3;
+      BOOST_CHECK_EQUAL(from_binary<Narrow>(to_binary(x)), Narrow(x));
+      BOOST_CHECK_EQUAL(from_binary<Wide>(to_binary(Narrow(x))), Wide(Narrow(x)));
+   }
+   // Ties round to even, and rounding up may carry into the exponent:
+   Wide tie = ldexp(Wide(1), std::numeric_limits<Narrow>::digits) + 1;
+   BOOST_CHECK_EQUAL(from_binary<Narrow>(to_binary(tie)), Narrow(tie));
+   tie += 2;
+   BOOST_CHECK_EQUAL(from_binary<Narrow>(to_binary(tie)), Narrow(tie));
+   Wide all_ones = ldexp(Wide(1), std::numeric_limits<Narrow>::digits + 3) - 1;
+   BOOST_CHECK_EQUAL(from_binary<Narrow>(to_binary(all_ones)), Narrow(all_ones));
+   BOOST_CHECK_EQUAL(from_binary<Narrow>(to_binary(Wide(-all_ones))), Narrow(-all_ones));
+}
+
+void test_encoding()
+{
+   using namespace boost::multiprecision;
+   //
+   // The header, then varint(2 bytes * 2 + sign) and the bytes, low first:
+   //
+   static const unsigned char expected[] = {'M', 'P', 1, 1, 0, 1, 4, 0x34, 0x12};
+   BOOST_CHECK(to_binary(cpp_int(0x1234)) == std::vector<unsigned char>(expected, expected + sizeof(expected)));
+   BOOST_CHECK(to_binary(int128_t(0x1234)) == std::vector<unsigned char>(expected, expected + sizeof(expected)));
+   static const unsigned char minus_one[] = {'M', 'P', 1, 1, 0, 1, 3, 1};
+   BOOST_CHECK(to_binary(cpp_int(-1)) == std::vector<unsigned char>(minus_one, minus_one + sizeof(minus_one)));
+   static const unsigned char zero[] = {'M', 'P', 1, 1, 0, 1, 0};
+   BOOST_CHECK(to_binary(cpp_int(0)) == std::vector<unsigned char>(zero, zero + sizeof(zero)));
+   //
+   // The size of the value is independent of the limb size:
+   //
+   BOOST_CHECK_EQUAL(to_binary(cpp_int(1) << 200).size(), 7u + 26u);
+   //
+   // cpp_bin_float_double: precision 53, then the class byte, zig-zag exponent and the odd
+   // significand 3 of 1.5:
+   //
+   static const unsigned char one_and_half[] = {'M', 'P', 1, 2, 53, 1, 1, 0, 2, 3};
+   BOOST_CHECK(to_binary(cpp_bin_float_double(1.5)) == std::vector<unsigned char>(one_and_half, one_and_half + sizeof(one_and_half)));
+   static const unsigned char minus_quarter[] = {'M', 'P', 1, 2, 53, 1, 0x81, 3, 2, 1};
+   BOOST_CHECK(to_binary(cpp_bin_float_double(-0.25)) == std::vector<unsigned char>(minus_quarter, minus_quarter + sizeof(minus_quarter)));
+   //
+   // cpp_dec_float_50: precision 50, the class byte, exponent 8, one element of 12:
+   //
+   static const unsigned char dec[] = {'M', 'P', 1, 3, 50, 1, 1, 16, 1, 12, 0, 0, 0};
+   BOOST_CHECK(to_binary(cpp_dec_float_50(1200000000)) == std::vector<unsigned char>(dec, dec + sizeof(dec)));
+}
+
+void test_bulk()
+{
+   using namespace boost::multiprecision;
+
+   std::vector<cpp_int> values;
+   for (unsigned i = 0; i < 100; ++i)
+      values.push_back(cpp_int(gen()) << (gen() % 1000));
+   std::vector<char> data;
+   write_binary(std::back_inserter(data), values.begin(), values.end());
+   std::vector<cpp_int> result;
+   BOOST_CHECK(read_binary(data.begin(), data.end(), result) == data.end());
+   BOOST_CHECK(result == values);
+   // Appending:
+   read_binary(data.begin(), data.end(), result);
+   BOOST_CHECK_EQUAL(result.size(), 200u);
+   BOOST_CHECK(std::equal(values.begin(), values.end(), result.begin() + 100));
+   //
+   // Blocks can follow each other in the same stream:
+   //
+   std::stringstream ss;
+   std::vector<cpp_bin_float_50> floats(10, cpp_bin_float_50(2) / 3);
+   write_binary(std::ostreambuf_iterator<char>(ss), floats.begin(), floats.end());
+   write_binary(std::ostreambuf_iterator<char>(ss), cpp_bin_float_50(1) / 7);
+   std::istreambuf_iterator<char>  i(ss), j;
+   std::vector<cpp_bin_float_50> floats2;
+   i = read_binary(i, j, floats2);
+   cpp_bin_float_50 x;
+   read_binary(i, j, x);
+   BOOST_CHECK(floats == floats2);
+   BOOST_CHECK_EQUAL(x, cpp_bin_float_50(1) / 7);
+   // An empty block:
+   data.clear();
+   write_binary(std::back_inserter(data), values.begin(), values.begin());
+   result.clear();
+   read_binary(data.begin(), data.end(), result);
+   BOOST_CHECK(result.empty());
+}
+
+//
+// An allocator which refuses anything large, so that reading a record can't allocate more than the
+// data present:
+//
+template <class T>
+struct small_allocator : public std::allocator<T>
+{
+   template <class U>
+   struct rebind
+   {
+      typedef small_allocator<U> other;
+   };
+   small_allocator() {}
+   template <class U>
+   small_allocator(const small_allocator<U>&) {}
+   T* allocate(std::size_t n, const void* = 0)
+   {
+      if (n * sizeof(T) > 4096)
+         throw std::bad_alloc();
+      return std::allocator<T>::allocate(n);
+   }
+};
+
+void test_errors()
+{
+   using namespace boost::multiprecision;
+
+   std::vector<unsigned char> data = to_binary(cpp_int(1) << 100);
+   cpp_int                    val  = 2;
+   checked_uint128_t          c;
+   number<cpp_int_backend<0, 0, signed_magnitude, unchecked, small_allocator<limb_type> > > small;
+   for (std::size_t n = 0; n < data.size(); ++n)
+      BOOST_CHECK_THROW(read_binary(data.begin(), data.begin() + n, val), std::runtime_error);
+   BOOST_CHECK_EQUAL(val, 2);
+   // Wrong kind of number:
+   cpp_bin_float_50 f;
+   BOOST_CHECK_THROW(read_binary(data.begin(), data.end(), f), std::runtime_error);
+   // Later version, bad magic:
+   std::vector<unsigned char> bad = data;
+   bad[2]                         = 2;
+   BOOST_CHECK_THROW(read_binary(bad.begin(), bad.end(), val), std::runtime_error);
+   bad    = data;
+   bad[0] = 'X';
+   BOOST_CHECK_THROW(read_binary(bad.begin(), bad.end(), val), std::runtime_error);
+   // More than one value:
+   std::vector<cpp_int> values(2);
+   bad.clear();
+   write_binary(std::back_inserter(bad), values.begin(), values.end());
+   BOOST_CHECK_THROW(read_binary(bad.begin(), bad.end(), val), std::runtime_error);
+   // An over-long varint:
+   static const unsigned char overlong[] = {'M', 'P', 1, 1, 0, 1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+   BOOST_CHECK_THROW(read_binary(overlong, overlong + sizeof(overlong), val), std::runtime_error);
+   BOOST_CHECK_EQUAL(val, 2);
+   // Records claiming more bytes than are present, or than a cpp_int can hold:
+   for (unsigned shift = 8; shift < 64; shift += 8)
+   {
+      bad.assign(data.begin(), data.begin() + 6);
+      for (boost::uintmax_t header = (static_cast<boost::uintmax_t>(1u) << shift) + 2; header; header >>= 7)
+         bad.push_back(static_cast<unsigned char>((header & 0x7Fu) | (header > 0x7Fu ? 0x80u : 0u)));
+      bad.insert(bad.end(), 40, 0xAB);
+      BOOST_CHECK_THROW(read_binary(bad.begin(), bad.end(), val), std::runtime_error);
+      BOOST_CHECK_THROW(read_binary(bad.begin(), bad.end(), c), std::runtime_error);
+      BOOST_CHECK_THROW(read_binary(bad.begin(), bad.end(), small), std::runtime_error);
+   }
+   BOOST_CHECK_EQUAL(val, 2);
+   // Values too large for checked types:
+   bad = to_binary(cpp_int(1) << 200);
+   BOOST_CHECK_THROW(read_binary(bad.begin(), bad.end(), c), std::runtime_error);
+   checked_uint1024_t c2;
+   read_binary(data.begin(), data.end(), c2);
+   BOOST_CHECK_EQUAL(c2, checked_uint1024_t(1) << 100);
+   // Decimal elements out of range:
+   bad = to_binary(cpp_dec_float_50(1));
+   bad[bad.size() - 1] = 0x10;
+   cpp_dec_float_50 d;
+   BOOST_CHECK_THROW(read_binary(bad.begin(), bad.end(), d), std::runtime_error);
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test_integer<cpp_int>();
+   test_integer<int128_t>();
+   test_integer<uint128_t>();
+   test_integer<int1024_t>();
+   test_integer<checked_uint512_t>();
+   test_integer<number<cpp_int_backend<70, 70, unsigned_magnitude, unchecked, void> > >();
+   //
+   // All cpp_int types share a format:
+   //
+   BOOST_CHECK_EQUAL(from_binary<cpp_int>(to_binary(int128_t(-12345))), -12345);
+   BOOST_CHECK_EQUAL(from_binary<int256_t>(to_binary(cpp_int(1) << 200)), int256_t(1) << 200);
+   BOOST_CHECK_EQUAL(from_binary<uint128_t>(to_binary(cpp_int(1) << 200)), 0);
+
+   test_float<cpp_bin_float_50>();
+   test_float<cpp_bin_float_double>();
+   test_float<cpp_bin_float_quad>();
+   test_float<number<cpp_bin_float<30, digit_base_10, std::allocator<char> > > >();
+   test_float<cpp_dec_float_50>();
+   test_float<number<cpp_dec_float<100, boost::int64_t> > >();
+   BOOST_CHECK(is_negative_zero(from_binary<cpp_bin_float_50>(to_binary(cpp_bin_float_50(-0.0)))));
+
+   test_float_precision_change<cpp_bin_float_double, cpp_bin_float_50>();
+   test_float_precision_change<cpp_bin_float_50, cpp_bin_float_100>();
+   // Exponents beyond the range of the narrower type:
+   BOOST_CHECK_EQUAL(from_binary<cpp_bin_float_double>(to_binary(ldexp(cpp_bin_float_50(1), 5000))), std::numeric_limits<cpp_bin_float_double>::infinity());
+   BOOST_CHECK_EQUAL(from_binary<cpp_bin_float_double>(to_binary(ldexp(cpp_bin_float_50(1), -5000))), 0);
+
+   cpp_dec_float_100 d = cpp_dec_float_100(2) / 3;
+   BOOST_CHECK_EQUAL(from_binary<cpp_dec_float_100>(to_binary(cpp_dec_float_50(d))), cpp_dec_float_100(cpp_dec_float_50(d)));
+   BOOST_CHECK_CLOSE_FRACTION(from_binary<cpp_dec_float_50>(to_binary(d)), cpp_dec_float_50(d), std::numeric_limits<cpp_dec_float_50>::epsilon());
+   //
+   // Everything else is written as a string:
+   //
+   check_round_trip(cpp_rational(cpp_rational(-3) / 4));
+
+   test_encoding();
+   test_bulk();
+   test_errors();
+
+   return boost::report_errors();
+}
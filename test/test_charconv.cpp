@@ -0,0 +1,254 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Check that to_chars formats exactly as str() does, that from_chars reads back what it
+// writes, and that both report errors as <charconv> does.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <sstream>
+#include <cstring>
+#include "test.hpp"
+
+#ifndef BOOST_NO_CXX11_HDR_SYSTEM_ERROR
+
+boost::random::mt19937 gen;
+
+template <class T>
+void check_to_chars(const T& val, std::streamsize digits, std::ios_base::fmtflags f)
+{
+   using namespace boost::multiprecision;
+   std::string expected = val.str(digits, f);
+   std::size_t size     = to_chars_size(val, digits, f);
+   BOOST_CHECK(size >= expected.size());
+   BOOST_CHECK(size <= 2 * expected.size() + 128);
+   std::vector<char> buffer(size + 1, 'z');
+   to_chars_result   r = to_chars(&buffer[0], &buffer[0] + size, val, digits, f);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK_EQUAL(std::string(&buffer[0], r.ptr), expected);
+   BOOST_CHECK_EQUAL(buffer[size], 'z');
+   //
+   // An exact fit, and one character short:
+   //
+   r = to_chars(&buffer[0], &buffer[0] + expected.size(), val, digits, f);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK_EQUAL(std::string(&buffer[0], r.ptr), expected);
+   r = to_chars(&buffer[0], &buffer[0] + expected.size() - 1, val, digits, f);
+   BOOST_CHECK(r.ec == std::errc::value_too_large);
+   BOOST_CHECK(r.ptr == &buffer[0] + expected.size() - 1);
+}
+
+template <class T>
+void check_stream(const T& val)
+{
+   std::stringstream ss;
+   ss << std::setw(60) << val << '|' << std::left << std::setfill('*') << std::setw(60) << val << '|' << val;
+   std::string s = val.str(ss.precision(), ss.flags() & ~std::ios_base::left);
+   std::string expected;
+   if (s.size() < 60)
+      expected.append(60 - s.size(), ' ');
+   expected += s + '|' + s;
+   if (s.size() < 60)
+      expected.append(60 - s.size(), '*');
+   expected += '|' + s;
+   BOOST_CHECK_EQUAL(ss.str(), expected);
+}
+
+template <class T>
+void check_from_chars(const std::string& s, const T& expected, std::size_t length, int base = 10)
+{
+   using namespace boost::multiprecision;
+   T                 val = 2;
+   from_chars_result r   = from_chars(s.data(), s.data() + s.size(), val, base);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK(r.ptr == s.data() + length);
+   BOOST_CHECK_EQUAL(val, expected);
+}
+
+template <class T>
+void check_from_chars_fails(const std::string& s)
+{
+   using namespace boost::multiprecision;
+   T                 val = 2;
+   from_chars_result r   = from_chars(s.data(), s.data() + s.size(), val);
+   BOOST_CHECK(r.ec == std::errc::invalid_argument);
+   BOOST_CHECK(r.ptr == s.data());
+   BOOST_CHECK_EQUAL(val, 2);
+}
+
+template <class T>
+void check_from_chars_out_of_range(const std::string& s)
+{
+   using namespace boost::multiprecision;
+   T                 val = 2;
+   from_chars_result r   = from_chars(s.data(), s.data() + s.size(), val);
+   BOOST_CHECK(r.ec == std::errc::result_out_of_range);
+   BOOST_CHECK(r.ptr == s.data() + s.size());
+   BOOST_CHECK_EQUAL(val, 2);
+}
+
+template <class Int>
+void test_integer()
+{
+   static const std::ios_base::fmtflags flags[] = {
+       std::ios_base::fmtflags(0),
+       std::ios_base::showpos,
+       std::ios_base::hex,
+       std::ios_base::hex | std::ios_base::showbase | std::ios_base::uppercase,
+       std::ios_base::oct,
+       std::ios_base::oct | std::ios_base::showbase};
+
+   Int val = 0;
+   for (unsigned i = 0; i < 200; ++i)
+   {
+      for (unsigned j = 0; j < sizeof(flags) / sizeof(flags[0]); ++j)
+         check_to_chars(val, 0, flags[j]);
+      if (std::numeric_limits<Int>::is_signed)
+         check_to_chars(Int(Int(0) - val), 0, std::ios_base::fmtflags(0));
+      check_stream(val);
+      check_from_chars(val.str() + "x", val, val.str().size());
+      check_from_chars(val.str(0, std::ios_base::hex), val, val.str(0, std::ios_base::hex).size(), 16);
+      val <<= 5;
+      val += gen() % 32;
+   }
+}
+
+template <class Float>
+void test_float()
+{
+   using namespace boost::multiprecision;
+   static const std::ios_base::fmtflags flags[] = {
+       std::ios_base::fmtflags(0),
+       std::ios_base::scientific,
+       std::ios_base::fixed,
+       std::ios_base::scientific | std::ios_base::showpos | std::ios_base::uppercase,
+       std::ios_base::fixed | std::ios_base::showpoint};
+
+   Float val = 1;
+   for (unsigned i = 0; i < 100; ++i)
+   {
+      for (unsigned j = 0; j < sizeof(flags) / sizeof(flags[0]); ++j)
+      {
+         check_to_chars(val, 0, flags[j]);
+         check_to_chars(Float(-val), 20, flags[j]);
+      }
+      check_stream(val);
+      std::string s = val.str(0, std::ios_base::scientific);
+      check_from_chars(s + "e", Float(s), s.size());
+      val *= Float(gen()) / Float(gen() + 1u);
+   }
+   check_to_chars(Float(0), 0, std::ios_base::fmtflags(0));
+   check_to_chars(std::numeric_limits<Float>::infinity(), 0, std::ios_base::fmtflags(0));
+
+   check_from_chars("1.5", Float(1.5), 3);
+   check_from_chars("-.5e1x", Float(-5), 5);
+   check_from_chars("5.e-1e", Float(0.5), 5);
+   check_from_chars("2e+", Float(2), 1);
+   check_from_chars("InFinity", std::numeric_limits<Float>::infinity(), 8);
+   check_from_chars("-infinit", Float(-std::numeric_limits<Float>::infinity()), 4);
+   check_from_chars_fails<Float>("");
+   check_from_chars_fails<Float>("+1");
+   check_from_chars_fails<Float>(" 1");
+   check_from_chars_fails<Float>(".e1");
+   check_from_chars_fails<Float>("-");
+   check_from_chars_fails<Float>("in");
+   check_from_chars_out_of_range<Float>("1e99999999999999999999");
+   check_from_chars_out_of_range<Float>("-1e99999999999999999999");
+
+   Float             x;
+   std::string       nan = "nan(123)x";
+   from_chars_result r   = from_chars(nan.data(), nan.data() + nan.size(), x);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK(r.ptr == nan.data() + 8);
+   BOOST_CHECK(boost::math::isnan(x));
+}
+
+#ifndef BOOST_NO_EXCEPTIONS
+//
+// An allocator which fails once a value grows past a few limbs:
+//
+template <class T>
+struct small_allocator : public std::allocator<T>
+{
+   template <class U>
+   struct rebind
+   {
+      typedef small_allocator<U> other;
+   };
+   small_allocator() {}
+   template <class U>
+   small_allocator(const small_allocator<U>&) {}
+   T* allocate(std::size_t n)
+   {
+      if (n > 8)
+         throw std::bad_alloc();
+      return std::allocator<T>::allocate(n);
+   }
+};
+
+void test_allocation_failure()
+{
+   //
+   // Running out of memory is not a parse error, and isn't reported as one:
+   //
+   using namespace boost::multiprecision;
+   typedef number<rational_adaptor<cpp_int_backend<0, 0, signed_magnitude, unchecked, small_allocator<limb_type> > > > small_rational;
+   small_rational    val = 2;
+   const std::string s(1000, '7');
+   BOOST_CHECK_THROW(from_chars(s.data(), s.data() + s.size(), val), std::bad_alloc);
+   BOOST_CHECK_EQUAL(val, 2);
+}
+#endif
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test_integer<cpp_int>();
+   test_integer<int128_t>();
+   test_integer<uint128_t>();
+   test_integer<int1024_t>();
+   test_integer<checked_uint1024_t>();
+   test_integer<number<cpp_int_backend<70, 70, signed_magnitude, unchecked, void> > >();
+   //
+   // Values too large for the stack buffers:
+   //
+   cpp_int big = (cpp_int(1) << 20000) - 1;
+   check_to_chars(big, 0, std::ios_base::fmtflags(0));
+   check_to_chars(cpp_int(-big), 0, std::ios_base::fmtflags(0));
+   check_to_chars(big, 0, std::ios_base::hex);
+   check_stream(big);
+
+   test_float<cpp_bin_float_50>();
+   test_float<cpp_dec_float_50>();
+
+   check_to_chars(cpp_rational(cpp_rational(-3) / 4), 0, std::ios_base::fmtflags(0));
+   check_from_chars("3/4", cpp_rational(cpp_rational(3) / 4), 3);
+   check_from_chars("-3/12/", cpp_rational(cpp_rational(-1) / 4), 5);
+   check_from_chars("-3/", cpp_rational(-3), 2);
+   check_from_chars_fails<cpp_rational>("/4");
+   check_from_chars_fails<cpp_rational>("1/0");
+   check_from_chars_fails<cpp_rational>("-1/000");
+   check_from_chars_out_of_range<checked_uint1024_t>("1" + std::string(400, '0'));
+#ifndef BOOST_NO_EXCEPTIONS
+   test_allocation_failure();
+#endif
+
+   return boost::report_errors();
+}
+
+#else
+
+int main() { return 0; }
+
+#endif
@@ -0,0 +1,162 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks that cpp_int_arena gives the same results as cpp_int inside and outside of arenas, and
+// that values which outlive their arena, or are destroyed on another thread, remain valid.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <vector>
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+#include <thread>
+#endif
+#include "test.hpp"
+
+using boost::multiprecision::cpp_int;
+using boost::multiprecision::cpp_int_arena;
+using boost::multiprecision::mp_arena;
+
+boost::random::mt19937 gen;
+
+cpp_int random_value(unsigned bits)
+{
+   cpp_int result;
+   for (unsigned i = 0; i < bits; i += 32)
+   {
+      result <<= 32;
+      result |= gen();
+   }
+   return result;
+}
+
+void test_values()
+{
+   for (unsigned bits = 32; bits <= 16384; bits *= 2)
+   {
+      for (unsigned i = 0; i < 10; ++i)
+      {
+         cpp_int a = random_value(bits), b = random_value(bits / 2 + 32);
+         if (i & 1)
+            a = -a;
+         cpp_int_arena pa(a), pb(b);
+         BOOST_CHECK_EQUAL(cpp_int(pa * pb), a * b);
+         BOOST_CHECK_EQUAL(cpp_int(pa * pa), a * a);
+         BOOST_CHECK_EQUAL(cpp_int(pa / pb), a / b);
+         BOOST_CHECK_EQUAL(cpp_int(pa % pb), a % b);
+         BOOST_CHECK_EQUAL(cpp_int((pa * pb + pa) / (pb + 1) - pa % pb), (a * b + a) / (b + 1) - a % b);
+         BOOST_CHECK_EQUAL(cpp_int(gcd(pa, pb)), gcd(a, b));
+         if (bits <= 1024)
+            BOOST_CHECK_EQUAL(cpp_int(powm(pa, pb, pb | 1)), powm(a, b, b | 1));
+         BOOST_CHECK_EQUAL(pa.str(), a.str());
+         BOOST_CHECK_EQUAL(cpp_int_arena(a.str()), pa);
+      }
+   }
+}
+
+cpp_int_arena make_value(unsigned bits)
+{
+   mp_arena      arena;
+   cpp_int_arena result = 1;
+   result <<= bits;
+   return result - 1;
+}
+
+void test_lifetimes()
+{
+   //
+   // Values declared before the arena which grow within it, and values made within it which are
+   // moved out, keep their storage:
+   //
+   cpp_int_arena              outer = 1;
+   std::vector<cpp_int_arena> values;
+   {
+      mp_arena arena(256);
+      for (unsigned i = 1; i < 2000; ++i)
+      {
+         outer *= i;
+         values.push_back(cpp_int_arena(1) << i);
+         cpp_int_arena t = outer * outer;
+         BOOST_CHECK_EQUAL(t / outer, outer);
+      }
+      {
+         // Nested arenas:
+         mp_arena      inner;
+         cpp_int_arena t = outer * 2;
+         values.push_back(t);
+      }
+      values.push_back(outer + 1);
+   }
+   cpp_int check = 1;
+   for (unsigned i = 1; i < 2000; ++i)
+   {
+      check *= i;
+      BOOST_CHECK_EQUAL(cpp_int(values[i - 1]), cpp_int(1) << i);
+   }
+   BOOST_CHECK_EQUAL(cpp_int(outer), check);
+   BOOST_CHECK_EQUAL(cpp_int(values[1999]), check * 2);
+   BOOST_CHECK_EQUAL(cpp_int(values[2000]), check + 1);
+   values.clear();
+   BOOST_CHECK_EQUAL(cpp_int(make_value(5000)), (cpp_int(1) << 5000) - 1);
+   //
+   // Values made in an arena and destroyed on another thread:
+   //
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+   std::vector<cpp_int_arena> moved;
+   {
+      mp_arena arena;
+      for (unsigned i = 0; i < 1000; ++i)
+         moved.push_back(cpp_int_arena(3) << (i * 7));
+      std::thread t([&moved]() {
+         for (unsigned i = 0; i < moved.size(); ++i)
+            BOOST_CHECK_EQUAL(cpp_int(moved[i]), cpp_int(3) << (i * 7));
+         moved.clear();
+      });
+      t.join();
+   }
+   {
+      mp_arena arena;
+      for (unsigned i = 0; i < 1000; ++i)
+         moved.push_back(cpp_int_arena(5) << (i * 7));
+   }
+   std::thread t([&moved]() {
+      mp_arena arena;
+      for (unsigned i = 0; i < moved.size(); ++i)
+         moved[i] *= 3;
+      moved.clear();
+   });
+   t.join();
+   //
+   // Blocks freed on another thread while their arena is being destroyed:
+   //
+   for (unsigned n = 0; n < 20; ++n)
+   {
+      std::thread u;
+      {
+         mp_arena arena;
+         for (unsigned i = 0; i < 200; ++i)
+            moved.push_back(cpp_int_arena(7) << (i * 7));
+         u = std::thread([&moved]() { moved.clear(); });
+      }
+      u.join();
+   }
+#endif
+}
+
+int main()
+{
+   test_values();
+   {
+      mp_arena arena;
+      test_values();
+   }
+   test_lifetimes();
+   return boost::report_errors();
+}
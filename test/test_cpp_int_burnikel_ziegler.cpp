@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compare Burnikel-Ziegler and Barrett (divisor<>) division results to GMP.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include "test_cpp_int_tiers.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4127) //  Conditional expression is constant
+#endif
+
+#ifndef TEST
+#define TEST 0
+#endif
+
+template <class N>
+void check_division(const boost::multiprecision::mpz_int& f, const boost::multiprecision::mpz_int& g)
+{
+   using namespace boost::multiprecision;
+
+   mpz_int q = f / g;
+   mpz_int r = f % g;
+
+   N f1(f);
+   N g1(g);
+   N q1 = f1 / g1;
+   N r1 = f1 % g1;
+   BOOST_CHECK_EQUAL(q1.str(), q.str());
+   BOOST_CHECK_EQUAL(r1.str(), r.str());
+   divide_qr(f1, g1, q1, r1);
+   BOOST_CHECK_EQUAL(q1.str(), q.str());
+   BOOST_CHECK_EQUAL(r1.str(), r.str());
+   divisor<N> d(g1);
+   BOOST_CHECK_EQUAL(N(f1 / d).str(), q.str());
+   BOOST_CHECK_EQUAL(N(f1 % d).str(), r.str());
+   d.divmod(f1, q1, r1);
+   BOOST_CHECK_EQUAL(q1.str(), q.str());
+   BOOST_CHECK_EQUAL(r1.str(), r.str());
+
+   if (new_test_errors())
+   {
+      std::cout << f1 << std::endl;
+      std::cout << f << std::endl;
+      std::cout << g1 << std::endl;
+      std::cout << g << std::endl;
+      std::cout << q1 << std::endl;
+      std::cout << q << std::endl;
+      std::cout << r1 << std::endl;
+      std::cout << r << std::endl;
+   }
+}
+
+template <class N>
+void check_sqrt(const boost::multiprecision::mpz_int& x)
+{
+   //
+   // With 32-bit limbs the integer square root divides by twice its partial root,
+   // so check it on the same large operands as the division:
+   //
+   N x1(x), r;
+   N s = sqrt(x1, r);
+   BOOST_CHECK_EQUAL(N(s * s + r), x1);
+   BOOST_CHECK(s * s <= x1);
+   BOOST_CHECK(x1 < (s + 1) * (s + 1));
+
+   if (new_test_errors())
+   {
+      std::cout << x1 << std::endl;
+      std::cout << s << std::endl;
+      std::cout << r << std::endl;
+   }
+}
+
+template <class N>
+void check_random_divisions(const boost::multiprecision::mpz_int& q, const boost::multiprecision::mpz_int& g)
+{
+   using namespace boost::multiprecision;
+
+   mpz_int f = generate_random<mpz_int>(msb(q) + 1 + msb(g));
+   check_division<N>(f, g);
+   check_division<N>(-f, g);
+   check_division<N>(f, -g);
+   check_division<N>(-f, -g);
+   // Exact and nearly exact quotients, where the estimated quotient digits are most often too large:
+   check_division<N>(q * g, g);
+   check_division<N>(q * g - 1, g);
+   check_division<N>(q * g + g - 1, g);
+   if (msb(f) >= backends::burnikel_ziegler_cutoff * sizeof(limb_type) * CHAR_BIT)
+   {
+      check_sqrt<N>(f);
+      check_sqrt<N>(g * g);
+      check_sqrt<N>(g * g - 1);
+   }
+}
+
+template <class N>
+void test(const N&)
+{
+   using namespace boost::multiprecision;
+
+   //
+   // Divisors from just below the cutoff, with quotients from the same size up
+   // to several times the size of the divisor:
+   //
+   const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   const unsigned min_limbs = backends::burnikel_ziegler_cutoff - 2;
+   const unsigned max_limbs = 20 * backends::burnikel_ziegler_cutoff;
+   const unsigned min_bits  = min_limbs * limb_bits;
+   const unsigned max_bits  = max_limbs * limb_bits;
+
+   test_random_operands(&check_random_divisions<N>, min_limbs, max_limbs);
+   //
+   // Special cases: all bits set, and divisors with just the top bit set, or just the top bit
+   // clear, which are the largest and smallest normalised divisors:
+   //
+   for (unsigned i = min_bits; i < max_bits; i += i / 3)
+   {
+      mpz_int a = 1;
+      a <<= i;
+      --a;
+      mpz_int b = 1;
+      b <<= i / 2 + 7;
+      check_division<N>(a, b);
+      check_division<N>(a, b - 1);
+      check_division<N>(a, b + 1);
+      check_division<N>(a, a >> (i / 3));
+      check_division<N>(a, a >> (i / 2));
+      check_division<N>(a * a, a);
+      check_division<N>(a * a - 1, a);
+      check_division<N>(a << (i / 2), (b >> 1) - 1);
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+#if (TEST == 1) || (TEST == 0)
+   test(cpp_int());
+#endif
+#if (TEST == 2) || (TEST == 0)
+   test(checked_cpp_int());
+#endif
+   return boost::report_errors();
+}
@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Check the unrolled fixed width add, subtract, multiply and compare against
+// cpp_int arithmetic reduced to the width of the type.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include "test.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4127) //  Conditional expression is constant
+#endif
+
+boost::random::mt19937 gen;
+
+//
+// A value of up to bits bits, with a random number of them used so that
+// the arguments have all the different limb counts, and with a bias towards
+// all ones so that carries propagate the full width:
+//
+boost::multiprecision::cpp_int random_value(unsigned bits)
+{
+   using boost::multiprecision::cpp_int;
+   unsigned used   = gen() % (bits + 1);
+   cpp_int  result = 0;
+   if (gen() % 4 == 0)
+      return used ? cpp_int((cpp_int(1) << used) - 1 - gen() % 2) : cpp_int(0);
+   for (unsigned i = 0; i < used; i += 32)
+   {
+      result <<= 32;
+      result |= gen();
+   }
+   return result & ((cpp_int(1) << used) - 1);
+}
+//
+// Unchecked types keep the low bits of the magnitude, unsigned types wrap negative values:
+//
+template <class T>
+boost::multiprecision::cpp_int reduce(const boost::multiprecision::cpp_int& val)
+{
+   using boost::multiprecision::cpp_int;
+   cpp_int modulus = cpp_int(1) << std::numeric_limits<T>::digits;
+   if (std::numeric_limits<T>::is_signed)
+   {
+      cpp_int r = abs(val) % modulus;
+      return val < 0 ? cpp_int(-r) : r;
+   }
+   cpp_int r = val % modulus;
+   return r < 0 ? cpp_int(r + modulus) : r;
+}
+
+template <class T>
+void test()
+{
+   using boost::multiprecision::cpp_int;
+   const unsigned bits = std::numeric_limits<T>::digits;
+
+   for (unsigned i = 0; i < 5000; ++i)
+   {
+      cpp_int a = random_value(bits);
+      cpp_int b = random_value(bits);
+      if (std::numeric_limits<T>::is_signed)
+      {
+         if (gen() & 1)
+            a = -a;
+         if (gen() & 1)
+            b = -b;
+      }
+      T a1(a), b1(b);
+
+      BOOST_CHECK_EQUAL(cpp_int(a1 + b1), reduce<T>(a + b));
+      BOOST_CHECK_EQUAL(cpp_int(a1 - b1), reduce<T>(a - b));
+      BOOST_CHECK_EQUAL(cpp_int(a1 * b1), reduce<T>(a * b));
+      BOOST_CHECK_EQUAL(cpp_int(a1 * a1), reduce<T>(a * a));
+      BOOST_CHECK_EQUAL(a1 < b1, a < b);
+      BOOST_CHECK_EQUAL(a1 > b1, a > b);
+      BOOST_CHECK_EQUAL(a1 == b1, a == b);
+      //
+      // In place, where the result aliases one or both arguments:
+      //
+      T r = a1;
+      r += b1;
+      BOOST_CHECK_EQUAL(cpp_int(r), reduce<T>(a + b));
+      r = b1;
+      r = a1 - r;
+      BOOST_CHECK_EQUAL(cpp_int(r), reduce<T>(a - b));
+      r = a1;
+      r *= b1;
+      BOOST_CHECK_EQUAL(cpp_int(r), reduce<T>(a * b));
+      r *= r;
+      BOOST_CHECK_EQUAL(cpp_int(r), reduce<T>(reduce<T>(a * b) * reduce<T>(a * b)));
+      r = a1;
+      r -= r;
+      BOOST_CHECK_EQUAL(r, 0);
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<uint256_t>();
+   test<int256_t>();
+   test<uint512_t>();
+   test<int512_t>();
+   test<uint1024_t>();
+   test<int1024_t>();
+   test<uint128_t>();
+   //
+   // Widths that aren't a whole number of limbs, and one too wide for the unrolled code:
+   //
+   test<number<cpp_int_backend<200, 200, unsigned_magnitude, unchecked, void> > >();
+   test<number<cpp_int_backend<300, 300, signed_magnitude, unchecked, void> > >();
+   test<number<cpp_int_backend<2048, 2048, unsigned_magnitude, unchecked, void> > >();
+
+   return boost::report_errors();
+}
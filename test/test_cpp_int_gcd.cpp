@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Check gcd (Lehmer's algorithm and the half gcd) and gcdext against the plain Euclidean
+// algorithm, with the half gcd cutoff pushed right down so that it recurses several levels.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include "test.hpp"
+
+boost::random::mt19937 gen;
+
+//
+// Random values of the given number of limbs, or with a bias towards runs of ones
+// and single set bits, which give long runs of small or large quotients:
+//
+boost::multiprecision::cpp_int random_value(unsigned limbs)
+{
+   using boost::multiprecision::cpp_int;
+   unsigned bits = limbs * sizeof(boost::multiprecision::limb_type) * CHAR_BIT;
+   switch (gen() % 6)
+   {
+   case 0:
+      return (cpp_int(1) << bits) - 1;
+   case 1:
+      return (cpp_int(1) << (bits - 1)) + gen();
+   default:
+      break;
+   }
+   cpp_int result;
+   for (unsigned i = 0; i < bits; i += 32)
+   {
+      result <<= 32;
+      result |= gen();
+   }
+   return result;
+}
+
+boost::multiprecision::cpp_int euclid_gcd(boost::multiprecision::cpp_int a, boost::multiprecision::cpp_int b)
+{
+   a = abs(a);
+   b = abs(b);
+   while (b)
+   {
+      a %= b;
+      a.swap(b);
+   }
+   return a;
+}
+
+template <class Int>
+void check_gcdext(const Int& a, const Int& b, const Int& expected)
+{
+   Int g, s, t;
+   gcdext(a, b, g, s, t);
+   BOOST_CHECK_EQUAL(g, expected);
+   BOOST_CHECK_EQUAL(s * a + t * b, g);
+   if (b == 0)
+   {
+      BOOST_CHECK_EQUAL(s, a < 0 ? -1 : (a == 0 ? 0 : 1));
+      BOOST_CHECK_EQUAL(t, 0);
+   }
+   else if (g != 0)
+   {
+      Int x = a < 0 ? Int(-s) : s;
+      BOOST_CHECK(-abs(b) < 2 * g * x);
+      BOOST_CHECK(2 * g * x <= abs(b));
+   }
+}
+
+void test(unsigned a_limbs, unsigned b_limbs, unsigned g_limbs)
+{
+   using boost::multiprecision::cpp_int;
+   cpp_int g = random_value(g_limbs);
+   cpp_int a = random_value(a_limbs) * g;
+   cpp_int b = random_value(b_limbs) * g;
+   cpp_int expected = euclid_gcd(a, b);
+   for (unsigned signs = 0; signs < 4; ++signs)
+   {
+      cpp_int x = signs & 1 ? cpp_int(-a) : a;
+      cpp_int y = signs & 2 ? cpp_int(-b) : b;
+      BOOST_CHECK_EQUAL(gcd(x, y), expected);
+      BOOST_CHECK_EQUAL(gcd(y, x), expected);
+      check_gcdext(x, y, expected);
+      check_gcdext(y, x, expected);
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   cpp_int_tuning t = get_cpp_int_tuning();
+   t.hgcd_cutoff    = 8;
+   set_cpp_int_tuning(t);
+
+   static const unsigned sizes[] = {1, 2, 3, 5, 8, 13, 30, 64, 150, 400};
+   for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+      for (unsigned j = 0; j <= i; ++j)
+         for (unsigned k = 0; k < 3; ++k)
+            test(sizes[i], sizes[j], 1 + k * sizes[j] / 2);
+
+   //
+   // Consecutive Fibonacci numbers take the most steps, all with quotient 1:
+   //
+   cpp_int f1 = 1, f2 = 1;
+   for (unsigned i = 0; i < 20000; ++i)
+   {
+      f1 += f2;
+      f1.swap(f2);
+   }
+   BOOST_CHECK_EQUAL(gcd(f1, f2), 1);
+   check_gcdext(f1, f2, cpp_int(1));
+   BOOST_CHECK_EQUAL(gcd(f1 * f2, f2 * (f1 + f2)), f2);
+
+   check_gcdext(cpp_int(0), cpp_int(0), cpp_int(0));
+   check_gcdext(cpp_int(0), cpp_int(-5), cpp_int(5));
+   check_gcdext(cpp_int(-5), cpp_int(0), cpp_int(5));
+   check_gcdext(cpp_int(12), cpp_int(18), cpp_int(6));
+   check_gcdext(int128_t(-240), int128_t(46), int128_t(2));
+   check_gcdext(int256_t(1) << 200, (int256_t(1) << 150) * 3, int256_t(1) << 150);
+
+   set_cpp_int_tuning(default_cpp_int_tuning());
+   cpp_int a = random_value(3000) * 12345, b = random_value(2500) * 12345;
+   BOOST_CHECK_EQUAL(gcd(a, b), euclid_gcd(a, b));
+   check_gcdext(a, b, euclid_gcd(a, b));
+
+   return boost::report_errors();
+}
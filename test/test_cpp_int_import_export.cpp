@@ -62,6 +62,15 @@ void test_round_trip_neg(T val, const boost::mpl::true_&)
    export_bits(val, std::back_inserter(cv), 8, false);
    import_bits(newval, cv.begin(), cv.end(), 8, false);
    BOOST_CHECK_EQUAL(-val, newval);
+   // The result is positive whatever the sign of the value overwritten:
+   newval = val;
+   import_bits(newval, &cv[0], &cv[0] + cv.size(), 8, false);
+   BOOST_CHECK_EQUAL(-val, newval);
+   newval = val;
+   std::vector<boost::multiprecision::limb_type> lv;
+   export_bits(val, std::back_inserter(lv), std::numeric_limits<boost::multiprecision::limb_type>::digits);
+   import_bits(newval, &lv[0], &lv[0] + lv.size());
+   BOOST_CHECK_EQUAL(-val, newval);
 }
 
 template <class T>
@@ -137,6 +146,40 @@ void test_round_trip(T val)
    import_bits(newval, cv.begin(), cv.end(), 6, false);
    BOOST_CHECK_EQUAL(val, newval);
 
+   //
+   // Whole limbs, which are copied rather than shifted in and out, in both orders:
+   //
+   typedef boost::multiprecision::limb_type limb_type;
+   std::vector<limb_type>                   lv;
+   export_bits(val, std::back_inserter(lv), std::numeric_limits<limb_type>::digits);
+   newval = 0;
+   import_bits(newval, lv.begin(), lv.end());
+   BOOST_CHECK_EQUAL(val, newval);
+   newval = 0;
+   import_bits(newval, &lv[0], &lv[0] + lv.size());
+   BOOST_CHECK_EQUAL(val, newval);
+   lv.clear();
+   export_bits(val, std::back_inserter(lv), std::numeric_limits<limb_type>::digits, false);
+   newval = 0;
+   import_bits(newval, lv.begin(), lv.end(), 0, false);
+   BOOST_CHECK_EQUAL(val, newval);
+   newval = 0;
+   import_bits(newval, &lv[0], &lv[0] + lv.size(), 0, false);
+   BOOST_CHECK_EQUAL(val, newval);
+   //
+   // Chunks narrower than the elements holding them can't be copied directly:
+   //
+   std::vector<boost::uint32_t> wv;
+   export_bits(val, std::back_inserter(wv), 8, false);
+   newval = 0;
+   import_bits(newval, &wv[0], &wv[0] + wv.size(), 8, false);
+   BOOST_CHECK_EQUAL(val, newval);
+   wv.clear();
+   export_bits(val, std::back_inserter(wv), 16);
+   newval = 0;
+   import_bits(newval, &wv[0], &wv[0] + wv.size(), 16);
+   BOOST_CHECK_EQUAL(val, newval);
+
    test_round_trip_neg(val, boost::mpl::bool_<std::numeric_limits<T>::is_signed>());
 }
 
@@ -159,8 +202,50 @@ void test_round_trip()
    test_round_trip(bug);
 }
 
+void test_view()
+{
+   using namespace boost::multiprecision;
+   static boost::random::mt19937 gen;
+
+   for (unsigned i = 0; i < 100; ++i)
+   {
+      cpp_int                a = generate_random<cpp_int>() << (i * 7);
+      cpp_int                b = generate_random<cpp_int>();
+      std::vector<limb_type> storage;
+      export_bits(a, std::back_inserter(storage), std::numeric_limits<limb_type>::digits, false);
+      // High order zeros are ignored:
+      storage.push_back(0);
+      cpp_int_view<> view(&storage[0], storage.size(), i & 1);
+      cpp_int        expected = i & 1 ? cpp_int(-a) : a;
+      BOOST_CHECK_EQUAL(view.value(), expected);
+      BOOST_CHECK(view.data() == &storage[0]);
+      BOOST_CHECK_EQUAL(view.size(), storage.size() - 1);
+      BOOST_CHECK_EQUAL(cpp_int(view.value() * b), expected * b);
+      BOOST_CHECK_EQUAL(cpp_int(view.value() + b), expected + b);
+      BOOST_CHECK_EQUAL(cpp_int(view.value() / (b + 1)), expected / (b + 1));
+      BOOST_CHECK_EQUAL(cpp_int(b % view.value()), b % expected);
+      const cpp_int& ref = view;
+      BOOST_CHECK_EQUAL(gcd(ref, b), gcd(expected, b));
+      //
+      // Copies of the value own their limbs, copies of the view don't:
+      //
+      cpp_int        copy(view.value());
+      cpp_int_view<> view_copy(view);
+      view_copy = view;
+      storage[0] ^= 1;
+      BOOST_CHECK_EQUAL(copy, expected);
+      BOOST_CHECK_EQUAL(view_copy.value(), i & 1 ? cpp_int(-(a ^ 1)) : cpp_int(a ^ 1));
+      copy *= view.value();
+      BOOST_CHECK_EQUAL(storage[0] & 1, (a & 1) ^ 1);
+   }
+   cpp_int_view<> zero(0, 0, true);
+   BOOST_CHECK_EQUAL(zero.value(), 0);
+   BOOST_CHECK_EQUAL(zero.value().sign(), 0);
+}
+
 int main()
 {
+   test_view();
    test_round_trip<boost::multiprecision::cpp_int>();
    test_round_trip<boost::multiprecision::checked_int1024_t>();
    test_round_trip<boost::multiprecision::checked_uint512_t>();
@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks that an arbitrary precision cpp_int with a larger internal limb cache holds values of up
+// to MinBits bits without allocating, still grows beyond that, and that copies, moves and swaps
+// between cached and allocated values work.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <memory>
+#include <vector>
+#include "test.hpp"
+
+using boost::multiprecision::cpp_int;
+using boost::multiprecision::limb_type;
+
+static unsigned allocation_count = 0;
+
+template <class T>
+struct counting_allocator : public std::allocator<T>
+{
+   template <class U>
+   struct rebind
+   {
+      typedef counting_allocator<U> other;
+   };
+   counting_allocator() {}
+   template <class U>
+   counting_allocator(const counting_allocator<U>&) {}
+   T* allocate(std::size_t n, const void* = 0)
+   {
+      ++allocation_count;
+      return std::allocator<T>().allocate(n);
+   }
+   void deallocate(T* p, std::size_t n)
+   {
+      std::allocator<T>().deallocate(p, n);
+   }
+};
+
+template <class T, class U>
+inline bool operator==(const counting_allocator<T>&, const counting_allocator<U>&)
+{
+   return true;
+}
+template <class T, class U>
+inline bool operator!=(const counting_allocator<T>&, const counting_allocator<U>&)
+{
+   return false;
+}
+
+boost::random::mt19937 gen;
+
+cpp_int random_value(unsigned bits)
+{
+   cpp_int result;
+   for (unsigned i = 0; i < bits; i += 32)
+   {
+      result <<= 32;
+      result |= gen();
+   }
+   return result;
+}
+
+template <unsigned Bits>
+void test()
+{
+   typedef boost::multiprecision::number<boost::multiprecision::cpp_int_backend<Bits, 0, boost::multiprecision::signed_magnitude, boost::multiprecision::unchecked, counting_allocator<limb_type> > > int_type;
+
+   BOOST_CHECK(std::numeric_limits<int_type>::is_bounded == false);
+   BOOST_CHECK(sizeof(int_type) >= Bits / CHAR_BIT);
+   //
+   // Values which fit in the cache, and the results of arithmetic on them which do too, never
+   // touch the allocator:
+   //
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      cpp_int a = random_value(Bits / 2), b = random_value(Bits / 4) + 1;
+      if (i & 1)
+         a = -a;
+      allocation_count = 0;
+      int_type x(a), y(b);
+      int_type r = x * y;
+      r += x;
+      r -= y;
+      int_type q = r / y, m = r % y;
+      int_type g = gcd(x, y);
+      r <<= Bits / 4 - 32;
+      r >>= 3;
+      BOOST_CHECK_EQUAL(allocation_count, 0u);
+      BOOST_CHECK_EQUAL(cpp_int(q), (a * b + a - b) / b);
+      BOOST_CHECK_EQUAL(cpp_int(m), (a * b + a - b) % b);
+      BOOST_CHECK_EQUAL(cpp_int(g), gcd(a, b));
+      BOOST_CHECK_EQUAL(cpp_int(r), ((a * b + a - b) << (Bits / 4 - 32)) >> 3);
+   }
+   //
+   // Rare large values grow as usual, and may be mixed freely with small ones:
+   //
+   std::vector<int_type> values;
+   std::vector<cpp_int>  check;
+   for (unsigned i = 0; i < 200; ++i)
+   {
+      cpp_int a = random_value(i % 10 ? Bits / 2 : Bits * 8);
+      values.push_back(int_type(a));
+      check.push_back(a);
+   }
+   for (unsigned i = 1; i < values.size(); ++i)
+   {
+      int_type t(values[i] * values[i - 1]);
+      BOOST_CHECK_EQUAL(cpp_int(t), check[i] * check[i - 1]);
+      swap(values[i], values[i - 1]);
+      BOOST_CHECK_EQUAL(cpp_int(values[i]), check[i - 1]);
+      BOOST_CHECK_EQUAL(cpp_int(values[i - 1]), check[i]);
+      swap(values[i], values[i - 1]);
+      int_type c(values[i]);
+      BOOST_CHECK_EQUAL(c, values[i]);
+      c = values[i - 1];
+      BOOST_CHECK_EQUAL(c, values[i - 1]);
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+      int_type m(std::move(c));
+      BOOST_CHECK_EQUAL(cpp_int(m), check[i - 1]);
+      c = std::move(t);
+      BOOST_CHECK_EQUAL(cpp_int(c), check[i] * check[i - 1]);
+#endif
+      BOOST_CHECK_EQUAL(cpp_int(values[i] / (values[i - 1] | 1)), check[i] / (check[i - 1] | 1));
+   }
+}
+
+int main()
+{
+   test<256>();
+   test<512>();
+   test<1024>();
+#ifndef BOOST_NO_CXX11_TEMPLATE_ALIASES
+   BOOST_CHECK(sizeof(boost::multiprecision::cpp_int_inline<512>) > sizeof(cpp_int));
+   BOOST_CHECK_EQUAL(sizeof(boost::multiprecision::cpp_int_inline<64>), sizeof(cpp_int));
+   BOOST_CHECK_EQUAL(boost::multiprecision::cpp_int_inline<512>(cpp_int(1) << 5000), cpp_int(1) << 5000);
+#endif
+   return boost::report_errors();
+}
@@ -223,6 +223,23 @@ typename boost::disable_if_c<boost::multiprecision::backends::is_fixed_precision
          std::cout << r << std::endl;
       }
 
+      // Squares take a separate code path:
+      r = f * f;
+      if (std::numeric_limits<N>::is_bounded)
+         r &= mask;
+      r1 = f1 * f1;
+      BOOST_CHECK_EQUAL(r1.str(), r.str());
+
+      if (last_error_count != (unsigned)boost::detail::test_errors())
+      {
+         last_error_count = boost::detail::test_errors();
+         std::cout << std::hex << std::showbase;
+         std::cout << f1 << std::endl;
+         std::cout << f << std::endl;
+         std::cout << r1 << std::endl;
+         std::cout << r << std::endl;
+      }
+
 #ifndef CI_SUPPRESS_KNOWN_ISSUES
       if (tim.elapsed() > 200)
 #else
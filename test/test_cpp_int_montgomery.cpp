@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compare Montgomery powm results to GMP.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include "test_cpp_int_tiers.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4127) //  Conditional expression is constant
+#endif
+
+#ifndef TEST
+#define TEST 0
+#endif
+
+template <class N>
+void check_powm(const boost::multiprecision::mpz_int& a, const boost::multiprecision::mpz_int& p, const boost::multiprecision::mpz_int& c)
+{
+   using namespace boost::multiprecision;
+
+   //
+   // GMP's result is always in [0, |c|), ours has the sign of a^p:
+   //
+   mpz_int r = powm(a, p, c);
+   if ((a < 0) && bit_test(p, 0) && (r != 0))
+      r -= abs(c);
+
+   N a1(a);
+   N p1(p);
+   N c1(c);
+   N r1 = powm(a1, p1, c1);
+   BOOST_CHECK_EQUAL(r1.str(), r.str());
+
+   if (new_test_errors())
+   {
+      std::cout << a1 << std::endl;
+      std::cout << p1 << std::endl;
+      std::cout << c1 << std::endl;
+      std::cout << r1 << std::endl;
+      std::cout << r << std::endl;
+   }
+}
+
+template <class N>
+void test(const N&)
+{
+   using namespace boost::multiprecision;
+
+   const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   const unsigned max_bits  = std::numeric_limits<N>::is_bounded ? std::numeric_limits<N>::digits : 40 * limb_bits;
+   //
+   // Exponent sizes either side of each change in window size, and of the minimum used:
+   //
+   static const unsigned exponent_bits[] = {1, 7, 8, 9, 23, 24, 79, 80, 239, 240, 671, 672, 1000};
+
+   for (unsigned bits = limb_bits + 1; bits <= max_bits; bits += bits / 3)
+   {
+      for (unsigned i = 0; i < sizeof(exponent_bits) / sizeof(exponent_bits[0]); ++i)
+      {
+         mpz_int c = generate_random<mpz_int>(bits) | 1;
+         mpz_int a = generate_random<mpz_int>(bits);
+         mpz_int p = generate_random<mpz_int>((std::min)(exponent_bits[i], max_bits));
+         check_powm<N>(a, p, c);
+         check_powm<N>(a % c, p, c);
+         check_powm<N>(c - 1, p, c);
+         check_powm<N>(mpz_int(0), p, c);
+         //
+         // Moduli with all bits set maximise the carries in the reduction, and
+         // those with few bits set minimise them:
+         //
+         mpz_int m = 1;
+         m <<= bits - 1;
+         check_powm<N>(a % m, p, m - 1);
+         check_powm<N>(a % m, p, m + 1);
+         check_powm<N>(a % m, p, (m - 1) * 2 + 1);
+         if (std::numeric_limits<N>::is_signed)
+         {
+            check_powm<N>(-(a % c), p, c);
+            check_powm<N>(a % c, p, -c);
+            check_powm<N>(-(a % c), p | 1, -c);
+         }
+      }
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+#if (TEST == 1) || (TEST == 0)
+   test(cpp_int());
+#endif
+#if (TEST == 2) || (TEST == 0)
+   test(checked_int1024_t());
+#endif
+#if (TEST == 3) || (TEST == 0)
+   test(uint512_t());
+#endif
+   return boost::report_errors();
+}
@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compare NTT multiplication results to GMP.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include "test_cpp_int_tiers.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4127) //  Conditional expression is constant
+#endif
+
+#ifndef TEST
+#define TEST 0
+#endif
+
+template <class N>
+void report_error(const N& f1, const boost::multiprecision::mpz_int& f, const N& g1, const boost::multiprecision::mpz_int& g, const N& r1, const boost::multiprecision::mpz_int& r)
+{
+   if (new_test_errors())
+   {
+      std::cout << f1 << std::endl;
+      std::cout << f << std::endl;
+      std::cout << g1 << std::endl;
+      std::cout << g << std::endl;
+      std::cout << r1 << std::endl;
+      std::cout << r << std::endl;
+   }
+}
+
+void check_product(const boost::multiprecision::mpz_int& f, const boost::multiprecision::mpz_int& g)
+{
+   using namespace boost::multiprecision;
+
+   mpz_int r = f * g;
+
+   cpp_int f1(f);
+   cpp_int g1(g);
+#if (TEST == 1) || (TEST == 0)
+   cpp_int r1 = f1 * g1;
+   BOOST_CHECK_EQUAL(r1.str(), r.str());
+   report_error(f1, f, g1, g, r1, r);
+   // Squaring only transforms one argument:
+   r1 = f1 * f1;
+   BOOST_CHECK_EQUAL(r1.str(), mpz_int(f * f).str());
+   report_error(f1, f, f1, f, r1, mpz_int(f * f));
+#endif
+#if (TEST == 2) || (TEST == 0)
+   //
+   // Cached transforms, multiply twice to check that the cache is reused correctly,
+   // and once more after a call which needs a different transform size:
+   //
+   ntt_multiplier<cpp_int> m(f1);
+   cpp_int                 r2 = m(g1);
+   BOOST_CHECK_EQUAL(r2.str(), r.str());
+   report_error(f1, f, g1, g, r2, r);
+   m.multiply(r2, g1);
+   BOOST_CHECK_EQUAL(r2.str(), r.str());
+   report_error(f1, f, g1, g, r2, r);
+   cpp_int g2 = g1 * g1;
+   r2         = m(g2);
+   BOOST_CHECK_EQUAL(r2.str(), mpz_int(f * g * g).str());
+   report_error(f1, f, g2, mpz_int(g * g), r2, mpz_int(f * g * g));
+   r2 = m(g1);
+   BOOST_CHECK_EQUAL(r2.str(), r.str());
+   report_error(f1, f, g1, g, r2, r);
+#endif
+}
+
+void check_random_products(const boost::multiprecision::mpz_int& f, const boost::multiprecision::mpz_int& g)
+{
+   check_product(f, g);
+   check_product(-f, g);
+}
+
+void test()
+{
+   using namespace boost::multiprecision;
+
+   const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+
+   test_random_operands(&check_random_products, backends::ntt_cutoff - 2, 4 * backends::ntt_cutoff);
+   //
+   // Special cases: products whose size is a power of 2 either side of the transform size,
+   // or just over it so that some of the coefficients wrap around, with all bits set to
+   // maximise the size of the coefficients:
+   //
+   for (unsigned n = 4096; n < 4 * backends::ntt_cutoff; n *= 2)
+   {
+      for (unsigned extra = 0; extra < 8; extra += 3)
+      {
+         mpz_int a = 1;
+         a <<= (n / 2 + extra) * limb_bits;
+         --a;
+         mpz_int b = 1;
+         b <<= (n / 2 - 1) * limb_bits;
+         --b;
+         check_product(a, b);
+         check_product(a, a);
+         check_product(b, a << (3 * limb_bits));
+      }
+   }
+}
+
+void test_scratch_size()
+{
+   using namespace boost::multiprecision;
+   //
+   // The scratch space reserved up front must cover the NTT from whichever tier reaches it,
+   // even when the NTT cutoff is below the Toom-Cook ones.  set_cpp_int_tuning won't accept
+   // such cutoffs, so set them directly:
+   //
+   const cpp_int_tuning saved = get_cpp_int_tuning();
+   cpp_int_tuning&      t     = backends::cpp_int_tuning_data();
+   t.karatsuba_cutoff         = 8;
+   t.ntt_cutoff               = 16;
+   t.toom3_cutoff = t.toom4_cutoff = 100000;
+   static const unsigned sizes[]   = {16, 45, 50, 100, 333, 1000};
+   for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+   {
+      unsigned wrap;
+      unsigned log_n = backends::ntt_transform_log(sizes[i], sizes[i], wrap);
+      BOOST_CHECK(backends::karatsuba_storage_size(sizes[i]) >= backends::ntt_storage_size(log_n, wrap));
+      mpz_int a = generate_random<mpz_int>(sizes[i] * sizeof(limb_type) * CHAR_BIT);
+      mpz_int b = generate_random<mpz_int>(sizes[i] * sizeof(limb_type) * CHAR_BIT * 9 / 10);
+      BOOST_CHECK_EQUAL((cpp_int(a) * cpp_int(b)).str(), mpz_int(a * b).str());
+      BOOST_CHECK_EQUAL((cpp_int(a) * cpp_int(a)).str(), mpz_int(a * a).str());
+      //
+      // Unbalanced products reserve space for their slices, not for a square of the longer argument:
+      //
+      mpz_int c = generate_random<mpz_int>(sizes[i] * sizeof(limb_type) * CHAR_BIT * 7);
+      BOOST_CHECK(backends::karatsuba_storage_size(7 * sizes[i], sizes[i]) < backends::karatsuba_storage_size(7 * sizes[i]));
+      BOOST_CHECK_EQUAL((cpp_int(c) * cpp_int(b)).str(), mpz_int(c * b).str());
+      BOOST_CHECK_EQUAL((cpp_int(b) * cpp_int(c)).str(), mpz_int(b * c).str());
+   }
+   t = saved;
+}
+
+int main()
+{
+   test_scratch_size();
+   test();
+   return boost::report_errors();
+}
@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks that cpp_int_pooled gives the same results as cpp_int, that blocks are reused, and that
+// values may be created on one thread and destroyed on another.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <vector>
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+#include <thread>
+#endif
+#include "test.hpp"
+
+using boost::multiprecision::cpp_int;
+using boost::multiprecision::cpp_int_pooled;
+
+template <class Gen>
+cpp_int random_value(Gen& gen, unsigned bits)
+{
+   cpp_int result;
+   for (unsigned i = 0; i < bits; i += 32)
+   {
+      result <<= 32;
+      result |= gen();
+   }
+   return result;
+}
+
+void test_values(unsigned seed)
+{
+   boost::random::mt19937 gen(seed);
+   for (unsigned bits = 32; bits <= 16384; bits *= 2)
+   {
+      for (unsigned i = 0; i < 10; ++i)
+      {
+         cpp_int a = random_value(gen, bits), b = random_value(gen, bits / 2 + 32);
+         if (i & 1)
+            a = -a;
+         cpp_int_pooled pa(a), pb(b);
+         BOOST_CHECK_EQUAL(cpp_int(pa * pb), a * b);
+         BOOST_CHECK_EQUAL(cpp_int(pa / pb), a / b);
+         BOOST_CHECK_EQUAL(cpp_int(pa % pb), a % b);
+         BOOST_CHECK_EQUAL(cpp_int(pa + pb), a + b);
+         BOOST_CHECK_EQUAL(cpp_int(gcd(pa, pb)), gcd(a, b));
+         if (bits <= 1024)
+            BOOST_CHECK_EQUAL(cpp_int(powm(pa, pb, pb | 1)), powm(a, b, b | 1));
+         BOOST_CHECK_EQUAL(pa.str(), a.str());
+         BOOST_CHECK_EQUAL(cpp_int_pooled(a.str()), pa);
+      }
+   }
+}
+
+void test_reuse()
+{
+   typedef boost::multiprecision::pooled_allocator<boost::multiprecision::limb_type> alloc_type;
+   alloc_type                                                                       a;
+   //
+   // Freed blocks are handed out again for any request in the same size class, and
+   // blocks too large to pool are still allocated correctly:
+   //
+   boost::multiprecision::limb_type* p = a.allocate(10);
+   a.deallocate(p, 10);
+   boost::multiprecision::limb_type* q = a.allocate(12);
+#ifdef BOOST_MP_USING_THREAD_LOCAL
+   BOOST_CHECK_EQUAL(p, q);
+#endif
+   a.deallocate(q, 12);
+   p = a.allocate(100000);
+   p[99999] = 1;
+   a.deallocate(p, 100000);
+   BOOST_CHECK(a == boost::multiprecision::pooled_allocator<char>());
+   boost::multiprecision::release_thread_limb_pool();
+}
+
+int main()
+{
+   test_values(0);
+   test_reuse();
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+   std::vector<std::thread> threads;
+   for (unsigned i = 0; i < 4; ++i)
+      threads.push_back(std::thread(test_values, i + 1));
+   for (unsigned i = 0; i < threads.size(); ++i)
+      threads[i].join();
+   //
+   // Values made on one thread and destroyed on another:
+   //
+   std::vector<cpp_int_pooled> values;
+   std::thread                 t([&values]() {
+      for (unsigned i = 0; i < 1000; ++i)
+         values.push_back(cpp_int_pooled(1) << i);
+   });
+   t.join();
+   for (unsigned i = 0; i < values.size(); ++i)
+      BOOST_CHECK_EQUAL(values[i], cpp_int_pooled(1) << i);
+   values.clear();
+#endif
+   return boost::report_errors();
+}
@@ -0,0 +1,264 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Check conversion of cpp_int to and from decimal, both the single limb loops and the
+// divide and conquer algorithms, and to and from hexadecimal and octal, against digits
+// found the slow way.  Also checks from_chars.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <algorithm>
+#include <cstring>
+#include "test.hpp"
+
+boost::random::mt19937 gen;
+
+boost::multiprecision::cpp_int random_value(unsigned limbs)
+{
+   boost::multiprecision::cpp_int result;
+   for (unsigned i = 0; i < limbs * sizeof(boost::multiprecision::limb_type) * CHAR_BIT; i += 32)
+   {
+      result <<= 32;
+      result |= gen();
+   }
+   return result;
+}
+
+std::string reference_decimal(boost::multiprecision::cpp_int x)
+{
+   std::string result;
+   bool        neg = x < 0;
+   x               = abs(x);
+   do
+   {
+      boost::multiprecision::cpp_int q, r;
+      divide_qr(x, boost::multiprecision::cpp_int(1000000000u), q, r);
+      unsigned v = r.convert_to<unsigned>();
+      for (unsigned i = 0; i < 9; ++i, v /= 10)
+         result += static_cast<char>('0' + v % 10);
+      x.swap(q);
+   } while (x != 0);
+   while ((result.size() > 1) && (*result.rbegin() == '0'))
+      result.erase(result.size() - 1);
+   if (neg)
+      result += '-';
+   std::reverse(result.begin(), result.end());
+   return result;
+}
+
+std::string reference_power_of_two(boost::multiprecision::cpp_int x, unsigned digit_bits, bool uppercase)
+{
+   const char* table = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+   std::string result;
+   do
+   {
+      result += table[static_cast<unsigned>(x & ((1u << digit_bits) - 1))];
+      x >>= digit_bits;
+   } while (x != 0);
+   std::reverse(result.begin(), result.end());
+   return result;
+}
+
+template <class Int>
+void check_from_chars(const std::string& s, int base, const Int& expected)
+{
+   //
+   // Trailing characters which aren't digits are not part of the number:
+   //
+   std::string buf = s + "z123";
+   Int         x   = 7;
+   boost::multiprecision::from_chars_result r = boost::multiprecision::from_chars(buf.data(), buf.data() + buf.size(), x, base);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK(r.ptr == buf.data() + s.size());
+   BOOST_CHECK_EQUAL(x, expected);
+#ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
+   x = 7;
+   r = boost::multiprecision::from_chars(std::string_view(buf).substr(0, s.size()), x, base);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK_EQUAL(x, expected);
+#endif
+}
+
+template <class Int>
+void check_power_of_two(const Int& x)
+{
+   BOOST_CHECK_EQUAL(x.str(0, std::ios_base::hex), reference_power_of_two(boost::multiprecision::cpp_int(x), 4, false));
+   BOOST_CHECK_EQUAL(x.str(0, std::ios_base::hex | std::ios_base::uppercase | std::ios_base::showbase), "0X" + reference_power_of_two(boost::multiprecision::cpp_int(x), 4, true));
+   BOOST_CHECK_EQUAL(x.str(0, std::ios_base::oct), reference_power_of_two(boost::multiprecision::cpp_int(x), 3, false));
+   BOOST_CHECK_EQUAL(Int("0x" + x.str(0, std::ios_base::hex)), x);
+   BOOST_CHECK_EQUAL(Int("0X000" + x.str(0, std::ios_base::hex | std::ios_base::uppercase)), x);
+   BOOST_CHECK_EQUAL(Int(x.str(0, std::ios_base::oct | std::ios_base::showbase)), x);
+   check_from_chars(x.str(0, std::ios_base::hex), 16, x);
+   check_from_chars(x.str(0, std::ios_base::oct), 8, x);
+}
+
+template <class Int>
+void check_decimal(const Int& x)
+{
+   std::string s = x.str();
+   BOOST_CHECK_EQUAL(s, reference_decimal(boost::multiprecision::cpp_int(x)));
+   BOOST_CHECK_EQUAL(Int(s), x);
+   check_from_chars(s, 10, x);
+   if (x > 0)
+      check_from_chars("000" + s, 10, x);
+}
+
+void test()
+{
+   using namespace boost::multiprecision;
+
+   static const unsigned sizes[] = {1, 2, 3, 7, 8, 9, 16, 31, 64, 100, 257, 600};
+   for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+   {
+      for (unsigned j = 0; j < 4; ++j)
+      {
+         cpp_int x = random_value(sizes[i]);
+         check_decimal(x);
+         check_decimal(cpp_int(-x));
+         check_decimal(cpp_int(x >> (gen() % 64)));
+         check_power_of_two(x);
+         check_power_of_two(cpp_int(x >> (gen() % 64)));
+      }
+   }
+   //
+   // Powers of 10 either side of the split points, which give long runs of zeros
+   // and nines to be padded correctly:
+   //
+   cpp_int p = 1;
+   for (unsigned k = 1; k < 9000; k += 1 + k / 8)
+   {
+      p = pow(cpp_int(10), k);
+      check_decimal(p);
+      check_decimal(cpp_int(p - 1));
+      check_decimal(cpp_int(p + 1));
+      check_decimal(cpp_int(-p));
+   }
+   check_decimal(cpp_int(0));
+   check_decimal(cpp_int(-1));
+   check_power_of_two(cpp_int(0));
+   check_power_of_two(cpp_int(1));
+   for (unsigned i = 1; i < 300; ++i)
+   {
+      check_power_of_two(cpp_int(cpp_int(1) << i));
+      check_power_of_two(cpp_int((cpp_int(1) << i) - 1));
+   }
+   check_power_of_two(uint1024_t(random_value(16)));
+   check_power_of_two((std::numeric_limits<uint1024_t>::max)());
+   check_power_of_two(number<cpp_int_backend<1000, 1000, unsigned_magnitude, unchecked> >(random_value(16)));
+   check_power_of_two((std::numeric_limits<number<cpp_int_backend<1000, 1000, unsigned_magnitude, unchecked> > >::max)());
+   check_power_of_two(number<cpp_int_backend<16384, 16384, signed_magnitude, checked, void> >(random_value(256)));
+
+   //
+   // Unchecked fixed precision types keep the low bits of values too large for them, checked ones throw,
+   // as do invalid digits:
+   //
+   cpp_int big = random_value(2048 / std::numeric_limits<limb_type>::digits);
+   BOOST_CHECK_EQUAL(uint1024_t("0x" + big.str(0, std::ios_base::hex)), uint1024_t(big & (std::numeric_limits<uint1024_t>::max)()));
+   BOOST_CHECK_EQUAL(uint1024_t(big.str(0, std::ios_base::oct | std::ios_base::showbase)), uint1024_t(big & (std::numeric_limits<uint1024_t>::max)()));
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(checked_uint1024_t("0x" + big.str(0, std::ios_base::hex)), std::overflow_error);
+   BOOST_CHECK_THROW(checked_uint1024_t("0x1" + std::string(256, '0')), std::overflow_error);
+   BOOST_CHECK_EQUAL(checked_uint1024_t("0x" + std::string(256, 'f')), (std::numeric_limits<checked_uint1024_t>::max)());
+   BOOST_CHECK_THROW(cpp_int("0x12345678123456781234567812345678g"), std::runtime_error);
+   BOOST_CHECK_THROW(cpp_int("0x1234567812345678123456781234567 "), std::runtime_error);
+   BOOST_CHECK_THROW(cpp_int("01234567012345670123456701234567012345678"), std::runtime_error);
+   BOOST_CHECK_THROW(cpp_int("0x-12345678123456781234567812345678"), std::runtime_error);
+#endif
+
+   check_decimal(uint1024_t(random_value(16)));
+   check_decimal(int1024_t(-random_value(15)));
+   check_decimal((std::numeric_limits<uint1024_t>::max)());
+   check_decimal(number<cpp_int_backend<16384, 16384, signed_magnitude, checked, void> >(random_value(256)));
+   check_decimal(number<cpp_int_backend<16384, 16384, unsigned_magnitude, unchecked> >(random_value(256)));
+   check_decimal(int128_t(-random_value(1)));
+   check_decimal(number<cpp_int_backend<64, 64, unsigned_magnitude, checked, void> >(random_value(1)));
+
+   //
+   // Decimal strings too long for fixed precision types, and invalid digits:
+   //
+   big = random_value(4096 / std::numeric_limits<limb_type>::digits);
+   BOOST_CHECK_EQUAL(uint1024_t(big.str()), uint1024_t(big & (std::numeric_limits<uint1024_t>::max)()));
+   BOOST_CHECK_EQUAL(int1024_t(cpp_int(-big).str()), -int1024_t(big & (std::numeric_limits<uint1024_t>::max)()));
+   check_from_chars(big.str(), 10, uint1024_t(big & (std::numeric_limits<uint1024_t>::max)()));
+   check_from_chars((std::numeric_limits<checked_uint1024_t>::max)().str(), 10, (std::numeric_limits<checked_uint1024_t>::max)());
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(checked_uint1024_t(big.str()), std::overflow_error);
+   BOOST_CHECK_THROW(checked_uint1024_t(cpp_int((std::numeric_limits<checked_uint1024_t>::max)() + 1).str()), std::overflow_error);
+   BOOST_CHECK_THROW(cpp_int(big.str() + "a"), std::runtime_error);
+   BOOST_CHECK_THROW(cpp_int("1" + std::string(20000, '0') + "-"), std::runtime_error);
+#endif
+
+   //
+   // from_chars reports rather than throws, and leaves the value alone on error:
+   //
+   std::string     s = big.str();
+   checked_int1024_t c = 7;
+   from_chars_result r = from_chars(s.data(), s.data() + s.size(), c);
+   BOOST_CHECK(r.ec == std::errc::result_out_of_range);
+   BOOST_CHECK(r.ptr == s.data() + s.size());
+   BOOST_CHECK_EQUAL(c, 7);
+   s = "-" + s;
+   r = from_chars(s.data(), s.data() + s.size(), c);
+   BOOST_CHECK(r.ec == std::errc::result_out_of_range);
+   BOOST_CHECK_EQUAL(c, 7);
+   check_from_chars("-" + (std::numeric_limits<checked_int1024_t>::max)().str(), 10, checked_int1024_t(-(std::numeric_limits<checked_int1024_t>::max)()));
+   check_from_chars("-0", 10, cpp_int(0));
+   check_from_chars("-1011", 2, cpp_int(-11));
+   check_from_chars("12", 8, cpp_int(10));
+   check_from_chars("1", 8, uint128_t(1));
+   check_from_chars("1", 8, checked_uint128_t(1));
+
+   static const char* const invalid[] = {"", "-", "+1", " 1", "x1", "-x"};
+   for (unsigned i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+   {
+      cpp_int x = 7;
+      r         = from_chars(invalid[i], invalid[i] + std::strlen(invalid[i]), x);
+      BOOST_CHECK(r.ec == std::errc::invalid_argument);
+      BOOST_CHECK(r.ptr == invalid[i]);
+      BOOST_CHECK_EQUAL(x, 7);
+   }
+   s = "-1";
+   uint1024_t u = 7;
+   r = from_chars(s.data(), s.data() + s.size(), u);
+   BOOST_CHECK(r.ec == std::errc::invalid_argument);
+   BOOST_CHECK_EQUAL(u, 7);
+   cpp_int x = 7;
+   s = "ff";
+   r = from_chars(s.data(), s.data() + s.size(), x);
+   BOOST_CHECK(r.ec == std::errc::invalid_argument);
+   r = from_chars(s.data(), s.data() + s.size(), x, 16);
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK_EQUAL(x, 255);
+   s = "1289";
+   r = from_chars(s.data(), s.data() + s.size(), x, 8);
+   BOOST_CHECK(r.ptr == s.data() + 2);
+   BOOST_CHECK_EQUAL(x, 10);
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test();
+   //
+   // Again with the divide and conquer algorithm all the way down:
+   //
+   cpp_int_tuning t            = get_cpp_int_tuning();
+   t.decimal_conversion_cutoff = 8;
+   t.burnikel_ziegler_cutoff   = 8;
+   t.karatsuba_cutoff          = 8;
+   t.karatsuba_square_cutoff   = 8;
+   set_cpp_int_tuning(t);
+   test();
+   set_cpp_int_tuning(default_cpp_int_tuning());
+
+   return boost::report_errors();
+}
@@ -0,0 +1,107 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2012 John Maddock.
+//  Copyright 2026 agent.
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Shared by the tests which compare one tier of the cpp_int arithmetic with GMP: random operands
+// (generate_random is the one from test_cpp_int_karatsuba.cpp), printing the operands of a check
+// which failed, and a loop which tests random operands sized around the tier's cutoffs until the
+// time limit is reached.
+//
+
+#ifndef BOOST_MP_TEST_CPP_INT_TIERS_HPP
+#define BOOST_MP_TEST_CPP_INT_TIERS_HPP
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int.hpp>
+#include "timer.hpp"
+#include "test.hpp"
+
+template <class T>
+T generate_random(unsigned bits_wanted)
+{
+   static boost::random::mt19937               gen;
+   typedef boost::random::mt19937::result_type random_type;
+
+   T        max_val;
+   unsigned digits;
+   if (std::numeric_limits<T>::is_bounded && (bits_wanted == (unsigned)std::numeric_limits<T>::digits))
+   {
+      max_val = (std::numeric_limits<T>::max)();
+      digits  = std::numeric_limits<T>::digits;
+   }
+   else
+   {
+      max_val = T(1) << bits_wanted;
+      digits  = bits_wanted;
+   }
+
+   unsigned bits_per_r_val = std::numeric_limits<random_type>::digits - 1;
+   while ((random_type(1) << bits_per_r_val) > (gen.max)())
+      --bits_per_r_val;
+
+   unsigned terms_needed = digits / bits_per_r_val + 1;
+
+   T val = 0;
+   for (unsigned i = 0; i < terms_needed; ++i)
+   {
+      val *= (gen.max)();
+      val += gen();
+   }
+   val %= max_val;
+   return val;
+}
+//
+// Returns true, with std::cout set to print in hex, if a check has failed since the last call, so
+// that the caller can print the operands:
+//
+inline bool new_test_errors()
+{
+   static unsigned last_error_count = 0;
+
+   if (last_error_count == (unsigned)boost::detail::test_errors())
+      return false;
+   last_error_count = boost::detail::test_errors();
+   std::cout << std::hex << std::showbase;
+   return true;
+}
+//
+// Calls check(f, g) with random operands of between min_limbs and max_limbs limbs each, until the
+// time limit is reached:
+//
+template <class Check>
+void test_random_operands(Check check, unsigned min_limbs, unsigned max_limbs)
+{
+   using boost::multiprecision::mpz_int;
+
+   static const unsigned                     limb_bits = sizeof(boost::multiprecision::limb_type) * CHAR_BIT;
+   static boost::random::mt19937             gen;
+   boost::random::uniform_int_distribution<> d(min_limbs * limb_bits, max_limbs * limb_bits);
+
+   timer tim;
+
+   do
+   {
+      mpz_int f = generate_random<mpz_int>(d(gen));
+      mpz_int g = generate_random<mpz_int>(d(gen));
+      check(f, g);
+
+#ifndef CI_SUPPRESS_KNOWN_ISSUES
+      if (tim.elapsed() > 200)
+#else
+      if (tim.elapsed() > 25)
+#endif
+      {
+         std::cout << "Timeout reached, aborting tests now....\n";
+         break;
+      }
+
+   } while (true);
+}
+
+#endif
@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compare Toom-Cook and unbalanced multiplication results to GMP.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include "test_cpp_int_tiers.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(disable : 4127) //  Conditional expression is constant
+#endif
+
+#ifndef TEST
+#define TEST 0
+#endif
+
+template <class N>
+void check_product(const boost::multiprecision::mpz_int& f, const boost::multiprecision::mpz_int& g)
+{
+   using namespace boost::multiprecision;
+
+   mpz_int r = f * g;
+   if (std::numeric_limits<N>::is_bounded)
+   {
+      // N is signed-magnitude, so it's the magnitude which gets truncated:
+      bool neg = r < 0;
+      r        = abs(r) & mpz_int((std::numeric_limits<N>::max)());
+      if (neg)
+         r = -r;
+   }
+
+   N f1(f);
+   N g1(g);
+   N r1 = f1 * g1;
+   BOOST_CHECK_EQUAL(r1.str(), r.str());
+
+   if (new_test_errors())
+   {
+      std::cout << f1 << std::endl;
+      std::cout << f << std::endl;
+      std::cout << g1 << std::endl;
+      std::cout << g << std::endl;
+      std::cout << r1 << std::endl;
+      std::cout << r << std::endl;
+   }
+}
+
+template <class N>
+void check_random_products(const boost::multiprecision::mpz_int& f, const boost::multiprecision::mpz_int& g)
+{
+   using namespace boost::multiprecision;
+
+   static const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+
+   check_product<N>(f, g);
+   // Near-balanced sizes, which is where Toom-Cook is used the most:
+   mpz_int h = generate_random<mpz_int>(msb(f) + 1 - limb_bits);
+   check_product<N>(f, h);
+   if (std::numeric_limits<N>::is_signed)
+   {
+      check_product<N>(-f, h);
+      check_product<N>(f, -h);
+   }
+   // Unbalanced sizes, split 3 ways by 2 or sliced into balanced pieces:
+   static boost::random::mt19937             gen;
+   boost::random::uniform_int_distribution<> du(backends::karatsuba_cutoff * limb_bits, (msb(f) + 1) * 2 / 3);
+   h = generate_random<mpz_int>(du(gen));
+   check_product<N>(f, h);
+   check_product<N>(h, f);
+}
+
+template <class N>
+void test(const N&)
+{
+   using namespace boost::multiprecision;
+
+   //
+   // Sizes either side of the Toom-3 and Toom-4 cutoffs, or as large as N can hold:
+   //
+   const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   const unsigned max_limbs = std::numeric_limits<N>::is_bounded ? std::numeric_limits<N>::digits / limb_bits : 8 * backends::toom4_cutoff;
+   const unsigned min_limbs = backends::toom3_cutoff - 2;
+   const unsigned max_bits  = max_limbs * limb_bits;
+   const unsigned min_bits  = min_limbs * limb_bits;
+
+   test_random_operands(&check_random_products<N>, min_limbs, max_limbs);
+   //
+   // Special cases: all bits set maximise the carries at every stage of the evaluation
+   // and interpolation, and a single bit set leaves most of the pieces zero:
+   //
+   for (unsigned i = min_bits; i < max_bits; i += i / 3)
+   {
+      mpz_int a = 1;
+      a <<= i;
+      --a;
+      check_product<N>(a, a);
+      mpz_int b = 1;
+      b <<= i / 2 + 7;
+      check_product<N>(a, b);
+      check_product<N>(b << (i / 2), a);
+      check_product<N>(a, a >> (i / 3));
+      check_product<N>(a, a >> (i / 2));
+      check_product<N>(a >> (i / 3), b << (i / 2));
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+#if (TEST == 1) || (TEST == 0)
+   test(cpp_int());
+#endif
+#if (TEST == 2) || (TEST == 0)
+   test(number<cpp_int_backend<64 * 2048, 64 * 2048, signed_magnitude, unchecked, void> >());
+#endif
+#if (TEST == 3) || (TEST == 0)
+   test(number<cpp_int_backend<64 * 2048, 64 * 2048, unsigned_magnitude, unchecked> >());
+#endif
+   return boost::report_errors();
+}
@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Check that changing the runtime multiplication, division and gcd cutoffs changes nothing but the speed.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <vector>
+#include "test.hpp"
+
+boost::random::mt19937 gen;
+
+boost::multiprecision::cpp_int random_value(unsigned limbs, bool all_ones)
+{
+   boost::multiprecision::cpp_int result;
+   for (unsigned i = 0; i < limbs * sizeof(boost::multiprecision::limb_type) * CHAR_BIT; i += 32)
+   {
+      result <<= 32;
+      result |= all_ones ? 0xFFFFFFFFu : gen();
+   }
+   return result;
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   const cpp_int_tuning defaults = default_cpp_int_tuning();
+   BOOST_CHECK_EQUAL(get_cpp_int_tuning().karatsuba_cutoff, backends::karatsuba_cutoff);
+   BOOST_CHECK_EQUAL(get_cpp_int_tuning().ntt_cutoff, backends::ntt_cutoff);
+   BOOST_CHECK_EQUAL(get_cpp_int_tuning().burnikel_ziegler_cutoff, backends::burnikel_ziegler_cutoff);
+
+   static const unsigned sizes[] = {8, 9, 13, 25, 40, 61, 100, 151, 300, 451, 1000, 2100};
+   std::vector<cpp_int>  values;
+   for (unsigned i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+   {
+      values.push_back(random_value(sizes[i], false));
+      values.push_back(-random_value(sizes[i], true));
+   }
+   std::vector<cpp_int>          products, quotients, gcds;
+   std::vector<divisor<cpp_int> > divisors;
+   for (unsigned i = 0; i < values.size(); ++i)
+   {
+      divisors.push_back(divisor<cpp_int>(cpp_int(values[i] - 1)));
+      for (unsigned j = 0; j < values.size(); ++j)
+      {
+         products.push_back(values[i] * values[j]);
+         quotients.push_back(products.back() / (values[i] - 1));
+         quotients.push_back(products.back() % (values[i] - 1));
+         gcds.push_back(gcd(products.back(), values[i] * (values[j] + 1)));
+      }
+   }
+   //
+   // The smallest cutoffs permitted push every algorithm down to sizes it would
+   // never normally see:
+   //
+   cpp_int_tuning t = {8, 8, 8, 12, 16, 8, 8, 8};
+   set_cpp_int_tuning(t);
+   BOOST_CHECK_EQUAL(get_cpp_int_tuning().toom4_cutoff, 12);
+   for (unsigned i = 0, k = 0; i < values.size(); ++i)
+      for (unsigned j = 0; j < values.size(); ++j, ++k)
+      {
+         BOOST_CHECK_EQUAL(values[i] * values[j], products[k]);
+         BOOST_CHECK_EQUAL(products[k] / (values[i] - 1), quotients[2 * k]);
+         BOOST_CHECK_EQUAL(products[k] % (values[i] - 1), quotients[2 * k + 1]);
+         BOOST_CHECK_EQUAL(gcd(products[k], values[i] * (values[j] + 1)), gcds[k]);
+         // Divisors built under the old cutoffs, some of them now above the new ones:
+         BOOST_CHECK_EQUAL(products[k] / divisors[i], quotients[2 * k]);
+         BOOST_CHECK_EQUAL(products[k] % divisors[i], quotients[2 * k + 1]);
+      }
+   divisors.clear();
+   for (unsigned i = 0; i < values.size(); ++i)
+      divisors.push_back(divisor<cpp_int>(cpp_int(values[i] - 1)));
+
+#ifndef BOOST_NO_EXCEPTIONS
+   t.karatsuba_cutoff = 2;
+   BOOST_CHECK_THROW(set_cpp_int_tuning(t), std::domain_error);
+   BOOST_CHECK_EQUAL(get_cpp_int_tuning().karatsuba_cutoff, 8);
+   //
+   // Cutoffs out of order are refused, and leave the current ones in place:
+   //
+   static const cpp_int_tuning unordered[] = {
+       {100, 100, 400, 300, 2000, 100, 1000, 200}, // toom4 < toom3
+       {100, 100, 50, 400, 2000, 100, 1000, 200},  // toom3 < karatsuba
+       {100, 100, 150, 400, 200, 100, 1000, 200},  // ntt < toom4
+       {40, 40, 30, 20, 10, 40, 1000, 200},        // everything backwards
+       {100, 50, 150, 400, 2000, 100, 1000, 200},  // squaring below karatsuba
+       {100, 100, 150, 400, 2000, 50, 1000, 200}}; // Burnikel-Ziegler below karatsuba
+   for (unsigned i = 0; i < sizeof(unordered) / sizeof(unordered[0]); ++i)
+   {
+      BOOST_CHECK_THROW(set_cpp_int_tuning(unordered[i]), std::domain_error);
+      BOOST_CHECK_EQUAL(get_cpp_int_tuning().toom4_cutoff, 12);
+   }
+   cpp_int_tuning equal = {64, 64, 64, 64, 64, 64, 8, 8};
+   set_cpp_int_tuning(equal);
+   BOOST_CHECK_EQUAL(get_cpp_int_tuning().ntt_cutoff, 64);
+   BOOST_CHECK_EQUAL(values[20] * values[21], products[20 * values.size() + 21]);
+#endif
+   set_cpp_int_tuning(defaults);
+   BOOST_CHECK_EQUAL(get_cpp_int_tuning().toom4_cutoff, backends::toom4_cutoff);
+   //
+   // And divisors built under the small cutoffs, used under the defaults:
+   //
+   for (unsigned i = 0, k = 0; i < values.size(); ++i)
+      for (unsigned j = 0; j < values.size(); ++j, ++k)
+      {
+         cpp_int q, r;
+         divisors[i].divmod(products[k], q, r);
+         BOOST_CHECK_EQUAL(q, quotients[2 * k]);
+         BOOST_CHECK_EQUAL(r, quotients[2 * k + 1]);
+      }
+
+   return boost::report_errors();
+}
@@ -0,0 +1,152 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks factorial, binomial and primorial against the obvious loops, and against each other.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#if !defined(TEST_MPZ) && !defined(TEST_CPP_INT)
+#define TEST_MPZ
+#define TEST_CPP_INT
+
+#ifdef _MSC_VER
+#pragma message("CAUTION!!: No backend type specified so testing everything.... this will take some time!!")
+#endif
+#ifdef __GNUC__
+#pragma warning "CAUTION!!: No backend type specified so testing everything.... this will take some time!!"
+#endif
+
+#endif
+
+#if defined(TEST_MPZ)
+#include <boost/multiprecision/gmp.hpp>
+#endif
+#ifdef TEST_CPP_INT
+#include <boost/multiprecision/cpp_int.hpp>
+#endif
+#include <vector>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+template <class I>
+void test_factorial()
+{
+   I f(1);
+   for (unsigned n = 0; n < 3000; ++n)
+   {
+      if (n)
+         f *= n;
+      BOOST_CHECK_EQUAL(factorial<I>(n), f);
+   }
+   // Values either side of the levels of the recursion:
+   for (unsigned n = 3000; n < 20000; ++n)
+      f *= n;
+   for (unsigned n = 20000; n < 20000 + 40; ++n)
+   {
+      f *= n;
+      if ((n % 7 == 0) || (n % 16 == 0) || (n % 16 == 15))
+         BOOST_CHECK_EQUAL(factorial<I>(n), f);
+   }
+   BOOST_CHECK_EQUAL(factorial<I>(30000) / factorial<I>(29998), I(30000) * 29999);
+   BOOST_CHECK_EQUAL(lsb(factorial<I>(65536)), 65535u);
+}
+
+template <class I>
+void test_binomial()
+{
+   //
+   // Every row of Pascal's triangle up to 300:
+   //
+   std::vector<I> row(1, I(1));
+   for (unsigned n = 0; n < 300; ++n)
+   {
+      for (unsigned k = 0; k <= n; ++k)
+         BOOST_CHECK_EQUAL(binomial<I>(n, k), row[k]);
+      BOOST_CHECK_EQUAL(binomial<I>(n, n + 1), 0);
+      BOOST_CHECK_EQUAL(binomial<I>(n, n + 1000), 0);
+      std::vector<I> next(n + 2, I(1));
+      for (unsigned k = 1; k <= n; ++k)
+         next[k] = row[k - 1] + row[k];
+      row.swap(next);
+   }
+   static const unsigned n[] = {1000, 4096, 10007, 50000};
+   for (unsigned i = 0; i < sizeof(n) / sizeof(n[0]); ++i)
+   {
+      static const unsigned k[] = {1, 2, 3, 17, 100, 999};
+      for (unsigned j = 0; j < sizeof(k) / sizeof(k[0]); ++j)
+      {
+         I b = factorial<I>(n[i]) / (factorial<I>(k[j]) * factorial<I>(n[i] - k[j]));
+         BOOST_CHECK_EQUAL(binomial<I>(n[i], k[j]), b);
+         BOOST_CHECK_EQUAL(binomial<I>(n[i], n[i] - k[j]), b);
+      }
+      BOOST_CHECK_EQUAL(binomial<I>(n[i], n[i] / 2), factorial<I>(n[i]) / (factorial<I>(n[i] / 2) * factorial<I>(n[i] - n[i] / 2)));
+   }
+   //
+   // Large n, where the values have large prime factors:
+   //
+   static const unsigned big[] = {65537u, 2147483647u, 4294967291u, 4294967295u};
+   for (unsigned i = 0; i < sizeof(big) / sizeof(big[0]); ++i)
+   {
+      I b(1);
+      for (unsigned k = 0; k <= 40; ++k)
+      {
+         BOOST_CHECK_EQUAL(binomial<I>(big[i], k), b);
+         b *= big[i] - k;
+         b /= k + 1;
+      }
+      BOOST_CHECK_EQUAL(binomial<I>(big[i], big[i]), 1);
+   }
+}
+
+template <class I>
+void test_primorial()
+{
+   I p(1);
+   for (unsigned n = 0; n < 20000; ++n)
+   {
+      bool prime = n >= 2;
+      for (unsigned d = 2; prime && (d * d <= n); ++d)
+         prime = n % d != 0;
+      if (prime)
+         p *= n;
+      if ((n < 1000) || prime || (n % 97 == 0))
+         BOOST_CHECK_EQUAL(primorial<I>(n), p);
+   }
+}
+
+#ifdef TEST_CPP_INT
+void test_fixed()
+{
+   typedef number<cpp_int_backend<>, et_off> cpp_int_no_et;
+
+   BOOST_CHECK_EQUAL(factorial<uint128_t>(34), uint128_t(factorial<cpp_int>(34)));
+   BOOST_CHECK_EQUAL(factorial<int256_t>(57), int256_t(factorial<cpp_int>(57)));
+   BOOST_CHECK_EQUAL(binomial<uint128_t>(128, 64), uint128_t(binomial<cpp_int>(128, 64)));
+   BOOST_CHECK_EQUAL(primorial<checked_uint256_t>(150), checked_uint256_t(primorial<cpp_int>(150)));
+   BOOST_CHECK_EQUAL(factorial<cpp_int_no_et>(500), cpp_int_no_et(factorial<cpp_int>(500)));
+}
+#endif
+
+int main()
+{
+#ifdef TEST_CPP_INT
+   test_factorial<cpp_int>();
+   test_binomial<cpp_int>();
+   test_primorial<cpp_int>();
+   test_fixed();
+#endif
+#ifdef TEST_MPZ
+   // These go straight to mpz_fac_ui, mpz_bin_uiui and mpz_primorial_ui:
+   test_factorial<mpz_int>();
+   test_binomial<mpz_int>();
+   test_primorial<mpz_int>();
+#endif
+   return boost::report_errors();
+}
@@ -0,0 +1,200 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks the per-thread counters enabled by BOOST_MP_INSTRUMENT_COUNTERS.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#define BOOST_MP_INSTRUMENT_COUNTERS
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/miller_rabin.hpp>
+#include <sstream>
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+#include <thread>
+#endif
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+cpp_int make_value(unsigned limbs)
+{
+   cpp_int result = 0;
+   for (unsigned i = 0; i < limbs; ++i)
+   {
+      result <<= sizeof(limb_type) * CHAR_BIT;
+      result |= static_cast<limb_type>(0x123456789abcdefull * (i + 1) | 1u);
+   }
+   return result;
+}
+
+instrumentation_counters since(const instrumentation_counters& start)
+{
+   return thread_instrumentation_counters() - start;
+}
+
+void test_allocation()
+{
+   instrumentation_counters start = thread_instrumentation_counters();
+   {
+      cpp_int a = make_value(200);
+      cpp_int b = a * a;
+      cpp_int c = b / make_value(77);
+      instrumentation_counters c1 = since(start);
+      BOOST_CHECK(c1[counter_cpp_int_allocate] > 0);
+      BOOST_CHECK(c1[counter_cpp_int_resize] > 0);
+      BOOST_CHECK(c1[counter_cpp_int_limbs] >= 600);
+      BOOST_CHECK(c1[counter_cpp_int_deallocate] < c1[counter_cpp_int_allocate]);
+   }
+   // Every block allocated has now been freed:
+   instrumentation_counters c2 = since(start);
+   BOOST_CHECK_EQUAL(c2[counter_cpp_int_allocate], c2[counter_cpp_int_deallocate]);
+   //
+   // Values which fit in the internal cache don't allocate:
+   //
+   start = thread_instrumentation_counters();
+   cpp_int x = 3, y = x * 5 + 7;
+   BOOST_CHECK_EQUAL(y, 22);
+   BOOST_CHECK_EQUAL(since(start)[counter_cpp_int_allocate], 0u);
+}
+
+void test_multiply()
+{
+   set_cpp_int_tuning(default_cpp_int_tuning());
+   cpp_int small = make_value(10), large = make_value(60), huge = make_value(1000), r;
+
+   reset_thread_instrumentation_counters();
+   r = small * 3;
+   BOOST_CHECK_EQUAL(thread_instrumentation_counters()[counter_multiply_limb], 1u);
+   reset_thread_instrumentation_counters();
+   r = small * make_value(9);
+   instrumentation_counters c = thread_instrumentation_counters();
+   BOOST_CHECK_EQUAL(c[counter_multiply_schoolbook], 1u);
+   BOOST_CHECK_EQUAL(c[counter_multiply_recursive], 0u);
+   reset_thread_instrumentation_counters();
+   r = small * small;
+   c = thread_instrumentation_counters();
+   BOOST_CHECK_EQUAL(c[counter_square_schoolbook], 1u);
+   BOOST_CHECK_EQUAL(c[counter_multiply_schoolbook], 0u);
+
+   reset_thread_instrumentation_counters();
+   r = large * (large + 1);
+   c = thread_instrumentation_counters();
+   BOOST_CHECK_EQUAL(c[counter_multiply_recursive], 1u);
+   BOOST_CHECK_EQUAL(c[counter_multiply_karatsuba], 1u);
+   BOOST_CHECK_EQUAL(c[counter_multiply_schoolbook], 3u);
+   BOOST_CHECK_EQUAL(r, large * large + large);
+
+   reset_thread_instrumentation_counters();
+   r = huge * (huge + 1);
+   c = thread_instrumentation_counters();
+   BOOST_CHECK_EQUAL(c[counter_multiply_recursive], 1u);
+   BOOST_CHECK(c[counter_multiply_toom4] + c[counter_multiply_toom3] > 0);
+   BOOST_CHECK(c[counter_multiply_schoolbook] > 9);
+
+   reset_thread_instrumentation_counters();
+   r = huge * (small + 1);
+   c = thread_instrumentation_counters();
+   BOOST_CHECK_EQUAL(c[counter_multiply_recursive], 0u);
+   r = huge * (large + 1);
+   c = thread_instrumentation_counters();
+   BOOST_CHECK_EQUAL(c[counter_multiply_recursive], 1u);
+   BOOST_CHECK_EQUAL(c[counter_multiply_unbalanced], 1u);
+}
+
+void test_divide()
+{
+   cpp_int a = make_value(20), b = make_value(10), big = make_value(2000), r;
+   reset_thread_instrumentation_counters();
+   r = a / 12345;
+   BOOST_CHECK_EQUAL(thread_instrumentation_counters()[counter_divide_limb], 1u);
+   reset_thread_instrumentation_counters();
+   r = a / b;
+   instrumentation_counters c = thread_instrumentation_counters();
+   BOOST_CHECK_EQUAL(c[counter_divide_schoolbook], 1u);
+   BOOST_CHECK_EQUAL(c[counter_divide_burnikel_ziegler], 0u);
+   reset_thread_instrumentation_counters();
+   r = big / make_value(600);
+   c = thread_instrumentation_counters();
+   BOOST_CHECK_EQUAL(c[counter_divide_burnikel_ziegler], 1u);
+   BOOST_CHECK(c[counter_divide_schoolbook] > 0);
+}
+
+void test_square_modulus()
+{
+   //
+   // The squarings in the primality tests go to the squaring routines, without copying the operand:
+   //
+   cpp_int n = (cpp_int(1) << 521) - 1, y = make_value(7), expected = y * y % n;
+   reset_thread_instrumentation_counters();
+   boost::multiprecision::detail::square_modulus(y, n);
+   instrumentation_counters c = thread_instrumentation_counters();
+   BOOST_CHECK_EQUAL(y, expected);
+   BOOST_CHECK_EQUAL(c[counter_square_schoolbook], 1u);
+   BOOST_CHECK_EQUAL(c[counter_multiply_schoolbook], 0u);
+}
+
+void test_bin_float()
+{
+   cpp_bin_float_50 one(1), third = one / 3;
+   reset_thread_instrumentation_counters();
+   cpp_bin_float_50 r = third * 3;
+   instrumentation_counters c = thread_instrumentation_counters();
+   BOOST_CHECK_EQUAL(c[counter_bin_float_normalize], 1u);
+   BOOST_CHECK_EQUAL(c[counter_bin_float_round], 1u);
+   reset_thread_instrumentation_counters();
+   r = (one + third) - one;
+   c = thread_instrumentation_counters();
+   BOOST_CHECK_EQUAL(c[counter_bin_float_normalize], 2u);
+   BOOST_CHECK_EQUAL(c[counter_bin_float_shift], 1u);
+   BOOST_CHECK(r > 0);
+}
+
+void test_reporting()
+{
+   reset_thread_instrumentation_counters();
+   instrumentation_counters c = thread_instrumentation_counters();
+   for (unsigned i = 0; i < instrumentation_counter_count; ++i)
+      BOOST_CHECK_EQUAL(c.values[i], 0u);
+   std::stringstream ss;
+   ss << c;
+   BOOST_CHECK(ss.str().empty());
+   cpp_int r = make_value(50) * make_value(50);
+   ss << thread_instrumentation_counters();
+   BOOST_CHECK(ss.str().find("multiply_recursive") != std::string::npos);
+   BOOST_CHECK(ss.str().find("divide") == std::string::npos);
+   BOOST_CHECK_EQUAL(std::string(instrumentation_counter_name(counter_divide_burnikel_ziegler)), "divide_burnikel_ziegler");
+   BOOST_CHECK(instrumentation_enabled);
+#ifndef BOOST_NO_CXX11_HDR_THREAD
+   //
+   // Each thread has its own counters:
+   //
+   reset_thread_instrumentation_counters();
+   unsigned long long other = 0;
+   std::thread        t([&other]() {
+      cpp_int r = make_value(50) * make_value(50);
+      other     = thread_instrumentation_counters()[counter_multiply_recursive];
+   });
+   t.join();
+   BOOST_CHECK_EQUAL(other, 1u);
+   BOOST_CHECK_EQUAL(thread_instrumentation_counters()[counter_multiply_recursive], 0u);
+#endif
+}
+
+int main()
+{
+   test_allocation();
+   test_multiply();
+   test_divide();
+   test_square_modulus();
+   test_bin_float();
+   test_reporting();
+   return boost::report_errors();
+}
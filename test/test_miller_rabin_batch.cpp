@@ -0,0 +1,143 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks that miller_rabin_test_batch agrees with baillie_psw_test, whatever the number of threads,
+// both for many candidates and for a few candidates whose trials are shared between threads.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/miller_rabin_batch.hpp>
+#include <iterator>
+#include <vector>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+template <class I>
+void test_small()
+{
+   std::vector<I> values;
+   for (unsigned i = 0; i < 20000; ++i)
+      values.push_back(I(i));
+   for (unsigned threads = 1; threads <= 8; threads *= 2)
+   {
+      std::vector<bool> result = miller_rabin_test_batch(values, 25, threads);
+      BOOST_CHECK_EQUAL(result.size(), values.size());
+      for (unsigned i = 0; i < values.size(); ++i)
+         BOOST_CHECK_EQUAL(result[i], baillie_psw_test(values[i]));
+   }
+}
+
+void test_large()
+{
+   boost::random::mt19937                                                       gen;
+   boost::random::independent_bits_engine<boost::random::mt19937, 1024, cpp_int> gen1024;
+   std::vector<cpp_int>                                                          values;
+   for (unsigned i = 0; i < 300; ++i)
+      values.push_back(gen1024() | 1);
+   values.push_back((cpp_int(1) << 1279) - 1);
+   values.push_back(((cpp_int(1) << 521) - 1) * ((cpp_int(1) << 607) - 1));
+
+   std::vector<bool> expected;
+   for (unsigned i = 0; i < values.size(); ++i)
+      expected.push_back(baillie_psw_test(values[i]));
+   for (unsigned threads = 1; threads <= 4; ++threads)
+   {
+      std::vector<bool> result;
+      miller_rabin_test_batch(values.begin(), values.end(), std::back_inserter(result), 25, gen, threads);
+      BOOST_CHECK(result == expected);
+   }
+   //
+   // A single candidate, or a few, with the trials split between the threads:
+   //
+   for (unsigned threads = 1; threads <= 16; threads *= 2)
+   {
+      for (unsigned count = 1; count <= 3; ++count)
+      {
+         std::vector<bool> result;
+         miller_rabin_test_batch(values.end() - count, values.end(), std::back_inserter(result), 25, threads, 17);
+         BOOST_CHECK(std::equal(result.begin(), result.end(), expected.end() - count));
+      }
+   }
+   // Any number of trials, including none:
+   for (unsigned trials = 0; trials < 6; ++trials)
+   {
+      std::vector<cpp_int> v(values.end() - 2, values.end());
+      std::vector<bool>    result = miller_rabin_test_batch(v, trials, 4);
+      BOOST_CHECK(result[0]);
+      BOOST_CHECK(!result[1]);
+   }
+   BOOST_CHECK(miller_rabin_test_batch(std::vector<cpp_int>(), 25).empty());
+}
+
+#ifndef BOOST_NO_EXCEPTIONS
+//
+// An allocator which fails once a set number of allocations have been made, on whichever thread:
+//
+boost::multiprecision::detail::atomic_unsigned_type allocations_left(0);
+
+template <class T>
+struct failing_allocator : public std::allocator<T>
+{
+   template <class U>
+   struct rebind
+   {
+      typedef failing_allocator<U> other;
+   };
+   failing_allocator() {}
+   template <class U>
+   failing_allocator(const failing_allocator<U>&) {}
+   T* allocate(std::size_t n, const void* = 0)
+   {
+      if (allocations_left-- == 0)
+      {
+         allocations_left = 0;
+         throw std::bad_alloc();
+      }
+      return std::allocator<T>::allocate(n);
+   }
+};
+
+void test_exceptions()
+{
+   typedef number<cpp_int_backend<0, 0, signed_magnitude, unchecked, failing_allocator<limb_type> > > int_type;
+   boost::random::independent_bits_engine<boost::random::mt19937, 1024, int_type>     gen1024;
+   allocations_left = ~0u;
+   std::vector<int_type> values;
+   for (unsigned i = 0; i < 50; ++i)
+      values.push_back(gen1024() | 1);
+   //
+   // An exception on a worker thread reaches the caller, rather than terminating the program:
+   //
+   for (unsigned threads = 1; threads <= 4; ++threads)
+   {
+      for (unsigned limit = 10; limit <= 5000; limit *= 3)
+      {
+         allocations_left = limit;
+         BOOST_CHECK_THROW(miller_rabin_test_batch(values, 25, threads), std::bad_alloc);
+      }
+   }
+   allocations_left = ~0u;
+   std::vector<bool> result = miller_rabin_test_batch(values, 25, 4);
+   for (unsigned i = 0; i < values.size(); ++i)
+      BOOST_CHECK_EQUAL(result[i], miller_rabin_test(values[i], 25));
+}
+#endif
+
+int main()
+{
+   test_small<unsigned>();
+   test_small<cpp_int>();
+   test_large();
+#ifndef BOOST_NO_EXCEPTIONS
+   test_exceptions();
+#endif
+   return boost::report_errors();
+}
@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks next_prime against a sieve of Eratosthenes, and that random_prime and random_safe_prime
+// give values of the requested size which pass the primality tests.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/prime_generation.hpp>
+#include <vector>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+boost::random::mt19937 gen;
+
+template <class I>
+void test_next_prime()
+{
+   static const unsigned limit = 1000000;
+   std::vector<bool>     composite(limit + 1);
+   composite[0] = composite[1] = true;
+   for (unsigned i = 2; i * i <= limit; ++i)
+      if (!composite[i])
+         for (unsigned j = i * i; j <= limit; j += i)
+            composite[j] = true;
+   //
+   // Every value below the limit, stepping from each prime to the next:
+   //
+   BOOST_CHECK_EQUAL(next_prime(I(0), 25, gen), 2);
+   BOOST_CHECK_EQUAL(next_prime(I(1), 25, gen), 2);
+   unsigned p = 2;
+   for (unsigned n = 2; n < limit; ++n)
+   {
+      if (n == p)
+      {
+         p = n + 1;
+         while ((p <= limit) && composite[p])
+            ++p;
+      }
+      if (p > limit)
+         break;
+      // Every value near a prime, and a sample of the others:
+      if ((p - n < 3) || (n % 97 == 0))
+         BOOST_CHECK_EQUAL(next_prime(I(n), 25, gen), p);
+   }
+   if (std::numeric_limits<I>::is_signed)
+      BOOST_CHECK_EQUAL(next_prime(I(-5), 25, gen), 2);
+   BOOST_CHECK_EQUAL(next_prime(I(2) * 3 + 1, 25), 11);
+}
+
+void test_large()
+{
+   //
+   // Nothing may be skipped between n and next_prime(n):
+   //
+   boost::random::mt19937 gen2;
+   for (unsigned bits = 64; bits <= 512; bits *= 2)
+   {
+      for (unsigned i = 0; i < 10; ++i)
+      {
+         cpp_int n = random_prime<cpp_int>(bits, 25, gen);
+         cpp_int p = next_prime(n, 25, gen2);
+         BOOST_CHECK(p > n);
+         BOOST_CHECK(miller_rabin_test(p, 25, gen2));
+         if (bits <= 128)
+         {
+            for (cpp_int k = n + 2; k < p; k += 2)
+               BOOST_CHECK(!miller_rabin_test(k, 25, gen2));
+         }
+      }
+   }
+   // 2^127 - 1 is prime, and 2^127 + 29 is the next one:
+   cpp_int m127 = (cpp_int(1) << 127) - 1;
+   BOOST_CHECK_EQUAL(next_prime(m127 - 2, 25, gen), m127);
+   BOOST_CHECK_EQUAL(next_prime(m127, 25, gen), m127 + 30);
+}
+
+void test_random()
+{
+   boost::random::mt19937 gen2;
+   for (unsigned bits = 2; bits <= 1024; bits = bits < 16 ? bits + 1 : bits * 2)
+   {
+      for (unsigned i = 0; i < (bits < 256 ? 20u : 2u); ++i)
+      {
+         cpp_int p = random_prime<cpp_int>(bits, 25, gen);
+         BOOST_CHECK_EQUAL(msb(p) + 1, bits);
+         BOOST_CHECK(miller_rabin_test(p, 25, gen2));
+      }
+      if (bits >= 3 && bits <= 512)
+      {
+         for (unsigned i = 0; i < (bits < 64 ? 20u : 1u); ++i)
+         {
+            cpp_int p = random_safe_prime<cpp_int>(bits, 25, gen);
+            BOOST_CHECK_EQUAL(msb(p) + 1, bits);
+            BOOST_CHECK(miller_rabin_test(p, 25, gen2));
+            BOOST_CHECK(miller_rabin_test((p - 1) / 2, 25, gen2));
+         }
+      }
+   }
+   for (unsigned i = 0; i < 20; ++i)
+   {
+      cpp_int p = random_safe_prime<cpp_int>(3, 25, gen);
+      BOOST_CHECK((p == 5) || (p == 7));
+   }
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(random_prime<cpp_int>(1, 25, gen), std::domain_error);
+   BOOST_CHECK_THROW(random_safe_prime<cpp_int>(2, 25, gen), std::domain_error);
+#endif
+}
+
+int main()
+{
+   test_next_prime<cpp_int>();
+   test_next_prime<boost::uint64_t>();
+   test_large();
+   test_random();
+   return boost::report_errors();
+}
@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 agent. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks trial_division against division by each prime in turn, for various bounds, and that
+// has_small_factor_batch agrees with has_small_factor.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/trial_division.hpp>
+#include <boost/random.hpp>
+#include <iterator>
+#include <vector>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+boost::uint32_t naive_smallest_factor(const trial_division& td, const cpp_int& n)
+{
+   for (std::size_t i = 0; i < td.primes().size(); ++i)
+      if (integer_modulus(n, td.primes()[i]) == 0)
+         return td.primes()[i];
+   return 0;
+}
+
+void test_primes()
+{
+   static const boost::uint32_t bounds[] = {0, 1, 2, 3, 10, 100, 1000, 65536};
+   static const boost::uint32_t counts[] = {0, 0, 1, 2, 4, 25, 168, 6542};
+   for (unsigned i = 0; i < sizeof(bounds) / sizeof(bounds[0]); ++i)
+   {
+      trial_division td(bounds[i]);
+      BOOST_CHECK_EQUAL(td.bound(), bounds[i]);
+      BOOST_CHECK_EQUAL(td.primes().size(), counts[i]);
+      cpp_int p(1);
+      for (std::size_t j = 0; j < td.primes().size(); ++j)
+         p *= td.primes()[j];
+      BOOST_CHECK_EQUAL(td.primorial(), p);
+   }
+   BOOST_CHECK_EQUAL(trial_division(100).primes().back(), 97u);
+   BOOST_CHECK_EQUAL(trial_division(97).primes().back(), 97u);
+}
+
+void test_small()
+{
+   trial_division td(1000);
+   for (int n = -5000; n < 5000; ++n)
+   {
+      boost::uint32_t expected = naive_smallest_factor(td, cpp_int(n));
+      BOOST_CHECK_EQUAL(td.smallest_factor(n), expected);
+      BOOST_CHECK_EQUAL(td.smallest_factor(cpp_int(n)), expected);
+      BOOST_CHECK_EQUAL(td.has_small_factor(n), expected != 0);
+   }
+   BOOST_CHECK_EQUAL(td.smallest_factor(0), 2u);
+   BOOST_CHECK_EQUAL(td.smallest_factor(1), 0u);
+   BOOST_CHECK_EQUAL(td.smallest_factor(997), 997u);
+   BOOST_CHECK_EQUAL(td.smallest_factor(1009), 0u);
+   BOOST_CHECK_EQUAL(td.smallest_factor(997u * 991u), 991u);
+   BOOST_CHECK_EQUAL(trial_division(1).smallest_factor(0), 0u);
+   BOOST_CHECK_EQUAL(td.smallest_factor(boost::uint64_t(4294967291u) * 983u), 983u);
+   BOOST_CHECK_EQUAL(td.smallest_factor(uint256_t(1) << 255), 2u);
+   BOOST_CHECK_EQUAL(td.smallest_factor(-int512_t(977) * 977 * 977), 977u);
+}
+
+void test_large()
+{
+   boost::random::mt19937                                                       gen;
+   boost::random::independent_bits_engine<boost::random::mt19937, 4096, cpp_int> gen4096;
+   boost::random::uniform_int_distribution<unsigned>                            bits(1, 4096);
+
+   static const boost::uint32_t bounds[] = {2, 3, 100, 65536, 100000};
+   for (unsigned b = 0; b < sizeof(bounds) / sizeof(bounds[0]); ++b)
+   {
+      trial_division       td(bounds[b]);
+      std::vector<cpp_int> values;
+      for (unsigned i = 0; i < 200; ++i)
+      {
+         cpp_int n = gen4096() >> bits(gen);
+         //
+         // Remove the smaller factors from some of the values, so that the larger ones are found:
+         //
+         if (i % 3 == 0)
+         {
+            for (std::size_t j = 0; j + 1 < td.primes().size(); ++j)
+               while (n && integer_modulus(n, td.primes()[j]) == 0)
+                  n /= td.primes()[j];
+         }
+         if (i % 2)
+            n = -n;
+         values.push_back(n);
+      }
+      values.push_back(cpp_int(0));
+      values.push_back(cpp_int(1));
+      values.push_back(cpp_int(-1));
+      values.push_back(td.primorial());
+      values.push_back(td.primorial() + 1);
+      values.push_back(td.primorial() * td.primorial() - 1);
+      values.push_back((cpp_int(1) << 4423) - 1); // prime
+      values.push_back(((cpp_int(1) << 4423) - 1) * 99991);
+
+      std::vector<bool> expected;
+      for (std::size_t i = 0; i < values.size(); ++i)
+      {
+         boost::uint32_t f = naive_smallest_factor(td, values[i]);
+         BOOST_CHECK_EQUAL(td.smallest_factor(values[i]), f);
+         expected.push_back(f != 0);
+      }
+      BOOST_CHECK(td.has_small_factor_batch(values) == expected);
+      //
+      // Batches of other sizes, through iterators:
+      //
+      for (std::size_t count = 0; count < 10; ++count)
+      {
+         std::vector<bool> result;
+         td.has_small_factor_batch(values.end() - count, values.end(), std::back_inserter(result));
+         BOOST_CHECK(std::equal(result.begin(), result.end(), expected.end() - count));
+         BOOST_CHECK_EQUAL(result.size(), count);
+      }
+   }
+   trial_division  td;
+   std::vector<int> small;
+   for (int i = -100; i < 100; ++i)
+      small.push_back(i);
+   std::vector<bool> result = td.has_small_factor_batch(small);
+   for (std::size_t i = 0; i < small.size(); ++i)
+      BOOST_CHECK_EQUAL(result[i], td.has_small_factor(small[i]));
+}
+
+int main()
+{
+   test_primes();
+   test_small();
+   test_large();
+   return boost::report_errors();
+}